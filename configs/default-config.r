@@ -24,6 +24,7 @@ extensions: make map! [
     Clipboard -
     Console +
     Crypt + 
+    CSV +
     Debugger +
     DNS +
     Event +
@@ -33,12 +34,14 @@ extensions: make map! [
     Gob +
     JavaScript -
     JPG +
+    JSON +
     Library +
     Locale +
     Network +
     ODBC -
     PNG +
     Process +
+    Rebin +
     Secure +
     Serial +
     Signal -
@@ -76,6 +76,7 @@ extensions: make map! [
     BMP -
     Clipboard -
     Crypt -
+    CSV -
     Console +
     Debugger +
     DNS -
@@ -87,12 +88,14 @@ extensions: make map! [
     Image -
     JavaScript +
     JPG -
+    JSON -
     Library -
     Locale -
     Network -
     ODBC -
     PNG -
     Process -
+    Rebin -
     Secure -
     Serial -
     Signal -
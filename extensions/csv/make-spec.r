@@ -0,0 +1,7 @@
+REBOL []
+
+name: 'CSV
+source: %csv/mod-csv.c
+includes: [
+    %prep/extensions/csv
+]
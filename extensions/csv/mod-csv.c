@@ -0,0 +1,585 @@
+//
+//  File: %mod-csv.c
+//  Summary: "CSV and TSV codec"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/csv/README.md
+//
+// The scanner works directly on the UTF-8 bytes, and only makes values for
+// the fields that are asked for.  Fields are pushed to the data stack as
+// they are scanned, and records (or columns) are popped from there.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-csv.h"
+
+
+// /COLUMNS makes a table with a slot for every column up to the highest one
+// asked for, so that index can't be arbitrarily big.
+//
+#define CSV_MAX_COLUMN 65536
+
+
+typedef struct {
+    const REBYTE *begin;  // start of the data, for error offsets
+    const REBYTE *end;
+    REBYTE delimiter;
+    bool infer;
+
+    // With /COLUMNS, slots[n] is the 1-based position in the output record
+    // of column n (0-based), or 0 if that column is not wanted.
+    //
+    const REBLEN *slots;
+    REBLEN num_slots;
+    REBLEN width;  // fields per record, 0 if records may be ragged
+} CSV_SCANNER;
+
+
+//
+//  Did_Infer_Csv_Number: C
+//
+// Numbers with leading zeros (other than a lone 0 before a decimal point)
+// are left as text, because they are usually codes ("007", ZIP codes) that
+// would lose information as INTEGER!.
+//
+static bool Did_Infer_Csv_Number(RELVAL *out, const REBYTE *cp, REBSIZ size)
+{
+    if (size == 0 or size > MAX_NUM_LEN)
+        return false;
+
+    const REBYTE *s = cp;
+    const REBYTE *e = cp + size;
+
+    bool negative = false;
+    if (*s == '-' or *s == '+') {
+        negative = (*s == '-');
+        ++s;
+    }
+
+    const REBYTE *digits = s;
+    REBU64 magnitude = 0;
+    bool overflow = false;
+    for (; s != e and *s >= '0' and *s <= '9'; ++s) {
+        REBU64 digit = *s - '0';
+        if (magnitude > (cast(REBU64, INT64_MAX) - digit) / 10)
+            overflow = true;
+        else
+            magnitude = magnitude * 10 + digit;
+    }
+    REBSIZ num_digits = s - digits;
+    if (num_digits > 1 and *digits == '0')
+        return false;
+
+    bool integral = true;
+    if (s != e and *s == '.') {
+        integral = false;
+        ++s;
+        const REBYTE *fraction = s;
+        while (s != e and *s >= '0' and *s <= '9')
+            ++s;
+        num_digits += s - fraction;
+    }
+    if (num_digits == 0)
+        return false;
+
+    if (s != e and (*s == 'e' or *s == 'E')) {
+        integral = false;
+        ++s;
+        if (s != e and (*s == '-' or *s == '+'))
+            ++s;
+        if (s == e or *s < '0' or *s > '9')
+            return false;
+        while (s != e and *s >= '0' and *s <= '9')
+            ++s;
+    }
+
+    if (s != e)
+        return false;
+
+    if (integral and not overflow) {
+        REBI64 i = cast(REBI64, magnitude);
+        Init_Integer(out, negative ? -i : i);
+        return true;
+    }
+
+    REBYTE buf[MAX_NUM_LEN + 1];  // Scan_Decimal() peeks past the end
+    memcpy(buf, cp, size);
+    buf[size] = '\0';
+    return Scan_Decimal(out, buf, size, true) != nullptr;
+}
+
+
+static void Init_Csv_Field(
+    RELVAL *out,
+    const CSV_SCANNER *sc,
+    const REBYTE *start,
+    const REBYTE *end,
+    bool quoted,
+    bool doubled  // quoted field contains "" sequences standing for "
+){
+    REBSIZ size = end - start;
+
+    if (not quoted and sc->infer and Did_Infer_Csv_Number(out, start, size))
+        return;
+
+    // Quoted fields can span lines, so CR LF inside them becomes LF.
+    //
+    if (not doubled) {
+        Init_Text(
+            out,
+            Append_UTF8_May_Fail(
+                nullptr, cs_cast(start), size, STRMODE_CRLF_TO_LF
+            )
+        );
+        return;
+    }
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    const REBYTE *segment = start;
+    const REBYTE *cp = start;
+    for (; cp != end; ++cp) {
+        if (*cp != '"')
+            continue;
+        Append_UTF8_May_Fail(  // keep one quote of the pair
+            mo->series,
+            cs_cast(segment),
+            (cp + 1) - segment,
+            STRMODE_CRLF_TO_LF
+        );
+        ++cp;  // skip the other one
+        segment = cp + 1;
+    }
+    Append_UTF8_May_Fail(
+        mo->series, cs_cast(segment), end - segment, STRMODE_CRLF_TO_LF
+    );
+
+    Init_Text(out, Pop_Molded_String(mo));
+}
+
+
+//
+//  Scan_Csv_Record: C
+//
+// Push the wanted fields of the record starting at `cp` to the data stack.
+// Returns the position after the record's line ending, or nullptr if the
+// data ran out before the record was known to be complete (unless `final`).
+//
+static const REBYTE *Scan_Csv_Record(
+    const CSV_SCANNER *sc,
+    const REBYTE *cp,
+    bool final
+){
+    const REBYTE *end = sc->end;
+    REBYTE delimiter = sc->delimiter;
+
+    REBDSP dsp_record = DSP;
+    if (sc->slots) {
+        REBLEN n;
+        for (n = 0; n < sc->width; ++n)
+            Init_Blank(DS_PUSH());  // missing fields are BLANK!
+    }
+
+    REBLEN column = 0;
+    while (true) {
+        const REBYTE *start = cp;
+        const REBYTE *finish = cp;
+        bool quoted = false;
+        bool doubled = false;
+
+        if (cp != end and *cp == '"') {
+            quoted = true;
+            start = ++cp;
+            while (true) {
+                const REBYTE *q = cast(const REBYTE*,
+                    memchr(cp, '"', end - cp)
+                );
+                if (not q) {
+                    if (final)
+                        fail ("Unterminated quoted field in CSV data");
+                    goto incomplete;
+                }
+                if (q + 1 == end and not final)
+                    goto incomplete;  // could be the first quote of a pair
+                if (q + 1 != end and q[1] == '"') {
+                    doubled = true;
+                    cp = q + 2;
+                    continue;
+                }
+                finish = q;
+                cp = q + 1;
+                break;
+            }
+            if (
+                cp != end
+                and *cp != delimiter and *cp != LF and *cp != CR
+            ){
+                DECLARE_LOCAL (offset);
+                Init_Integer(offset, (cp - sc->begin) + 1);
+                rebJumps(
+                    "fail [{Text after closing quote of CSV field at byte}",
+                        offset,
+                    "]", rebEND
+                );
+            }
+        }
+        else {
+            start = cp;
+            while (cp != end and *cp != delimiter and *cp != LF and *cp != CR)
+                ++cp;
+            finish = cp;
+        }
+
+        if (cp == end and not final)
+            goto incomplete;
+
+        if (sc->slots) {  // only materialize the columns asked for
+            if (column < sc->num_slots and sc->slots[column] != 0) {
+                RELVAL *slot = DS_AT(dsp_record + sc->slots[column]);
+                Init_Csv_Field(slot, sc, start, finish, quoted, doubled);
+            }
+        }
+        else {
+            if (sc->width != 0 and column == sc->width)
+                fail ("CSV record has more fields than the first record");
+            Init_Csv_Field(DS_PUSH(), sc, start, finish, quoted, doubled);
+        }
+        ++column;
+
+        if (cp == end)
+            break;
+        if (*cp == delimiter) {
+            ++cp;
+            continue;
+        }
+        if (*cp == CR) {
+            ++cp;
+            if (cp == end and not final)
+                goto incomplete;  // might be CR LF split across reads
+            if (cp != end and *cp == LF)
+                ++cp;
+        }
+        else
+            ++cp;  // LF
+        break;
+    }
+
+    if (sc->width != 0 and not sc->slots) {  // pad short records
+        for (; column < sc->width; ++column)
+            Init_Blank(DS_PUSH());
+    }
+    return cp;
+
+  incomplete:
+    DS_DROP_TO(dsp_record);
+    return nullptr;
+}
+
+
+//
+//  export scan-csv: native [
+//
+//  {Split delimited text (with RFC 4180 quoting) into records of fields}
+//
+//      return: "Block of records (each a BLOCK!), or columns with /COLUMNAR"
+//          [block!]
+//      data "UTF-8 data (a leading byte order mark is skipped)"
+//          [binary! text!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//      /columns "Only materialize these columns (1-based, in this order)"
+//          [block!]
+//      /infer "Make INTEGER! or DECIMAL! of unquoted fields that are numbers"
+//      /columnar "Give back one BLOCK! per column instead of per record"
+//      /vectors "With /COLUMNAR and /INFER, make all-number columns VECTOR!"
+//      /next "Only take complete records, give back position after them"
+//          [<output>]  ; binary! text!
+//  ]
+//
+REBNATIVE(scan_csv)
+//
+// Empty lines are skipped.  Quoted fields are always TEXT!, even with /INFER,
+// and may contain delimiters and line breaks.  Missing fields are BLANK!.
+{
+    CSV_INCLUDE_PARAMS_OF_SCAN_CSV;
+
+    REBVAL *data = ARG(data);
+
+    REBSIZ size;
+    const REBYTE *bp;
+    if (IS_BINARY(data)) {
+        bp = VAL_BIN_AT(data);
+        size = VAL_LEN_AT(data);
+    }
+    else
+        bp = VAL_UTF8_AT(&size, data);
+
+    const REBYTE *cp = bp;
+    if (size >= 3 and cp[0] == 0xEF and cp[1] == 0xBB and cp[2] == 0xBF)
+        cp += 3;
+
+    CSV_SCANNER scanner;
+    CSV_SCANNER *sc = &scanner;
+    sc->begin = bp;
+    sc->end = bp + size;
+    sc->delimiter = ',';
+    sc->infer = did REF(infer);
+    sc->slots = nullptr;
+    sc->num_slots = 0;
+    sc->width = 0;
+
+    if (REF(delimiter)) {
+        REBUNI c = VAL_CHAR(ARG(delimiter));
+        if (c >= 0x80 or c == '"' or c == CR or c == LF)
+            fail (PAR(delimiter));
+        sc->delimiter = cast(REBYTE, c);
+    }
+
+    if (REF(vectors) and not (REF(columnar) and REF(infer)))
+        fail (Error_Bad_Refines_Raw());
+
+    REBSER *slots = nullptr;
+    if (REF(columns)) {
+        RELVAL *item;
+        REBLEN max = 0;
+        for (item = VAL_ARRAY_AT(ARG(columns)); NOT_END(item); ++item) {
+            if (
+                not IS_INTEGER(item)
+                or VAL_INT64(item) < 1
+                or VAL_INT64(item) > CSV_MAX_COLUMN
+            ){
+                fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(ARG(columns))));
+            }
+            if (VAL_INT64(item) > cast(REBI64, max))
+                max = Int32(item);
+        }
+
+        slots = Make_Series(max + 1, sizeof(REBLEN));
+        REBLEN *s = SER_HEAD(REBLEN, slots);
+        memset(s, 0, sizeof(REBLEN) * max);
+
+        REBLEN n = 0;
+        for (item = VAL_ARRAY_AT(ARG(columns)); NOT_END(item); ++item) {
+            REBLEN column = Int32(item) - 1;
+            if (s[column] != 0)
+                fail ("Column asked for more than once in SCAN-CSV/COLUMNS");
+            s[column] = ++n;
+        }
+
+        sc->slots = s;
+        sc->num_slots = max;
+        sc->width = n;
+    }
+
+    const bool final = not REF(next);
+
+    REBDSP dsp_orig = DSP;
+    REBLEN num_records = 0;
+
+    while (cp != sc->end) {
+        if (*cp == LF or *cp == CR) {  // skip empty lines
+            ++cp;
+            continue;
+        }
+
+        REBDSP dsp_record = DSP;
+        const REBYTE *next = Scan_Csv_Record(sc, cp, final);
+        if (not next)
+            break;  // incomplete record, leave for the next call
+        cp = next;
+        ++num_records;
+
+        if (REF(columnar)) {  // keep fields flat on the stack, sized evenly
+            if (sc->width == 0)
+                sc->width = DSP - dsp_record;
+        }
+        else {
+            REBARR *record = Pop_Stack_Values(dsp_record);
+            Init_Block(DS_PUSH(), record);
+        }
+    }
+
+    if (not REF(columnar))
+        Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+    else {
+        REBLEN width = sc->width;
+        REBARR *columns = Make_Array(width);
+        REBLEN c;
+        for (c = 0; c < width; ++c) {
+            REBARR *a = Make_Array(num_records);
+            RELVAL *dest = ARR_HEAD(a);
+            REBLEN r;
+            for (r = 0; r < num_records; ++r, ++dest)
+                Move_Value(dest, DS_AT(dsp_orig + (r * width) + c + 1));
+            TERM_ARRAY_LEN(a, num_records);
+            Init_Block(ARR_AT(columns, c), a);
+        }
+        TERM_ARRAY_LEN(columns, width);
+        DS_DROP_TO(dsp_orig);
+
+        Init_Block(D_OUT, columns);  // guards the columns from GC
+
+        if (REF(vectors)) {
+            RELVAL *column = ARR_HEAD(columns);
+            for (; NOT_END(column); ++column) {
+                bool integral = true;
+                RELVAL *item = VAL_ARRAY_HEAD(column);
+                for (; NOT_END(item); ++item) {
+                    if (IS_DECIMAL(item))
+                        integral = false;
+                    else if (not IS_INTEGER(item))
+                        break;
+                }
+                if (NOT_END(item) or VAL_LEN_HEAD(column) == 0)
+                    continue;  // not all numbers, leave as BLOCK!
+
+                REBVAL *vector = rebValue(
+                    "make vector! [",
+                        integral ? "integer! 64" : "decimal! 64",
+                        KNOWN(column),
+                    "]", rebEND
+                );
+                Move_Value(column, vector);
+                rebRelease(vector);
+            }
+        }
+    }
+
+    if (slots)
+        Free_Unmanaged_Series(slots);
+
+    if (REF(next)) {
+        REBVAL *var = Sink_Var_May_Fail(ARG(next), SPECIFIED);
+        Move_Value(var, data);
+        if (IS_BINARY(var))
+            VAL_INDEX(var) += cp - bp;
+        else
+            VAL_INDEX(var) += Num_Codepoints_For_Bytes(bp, cp);
+    }
+
+    return D_OUT;
+}
+
+
+static void Encode_Csv_Text(
+    REB_MOLD *mo,
+    const REBYTE *utf8,
+    REBSIZ size,
+    REBYTE delimiter
+){
+    const REBYTE *end = utf8 + size;
+    const REBYTE *cp = utf8;
+    for (; cp != end; ++cp) {
+        if (*cp == delimiter or *cp == '"' or *cp == LF or *cp == CR)
+            break;
+    }
+    if (cp == end) {  // nothing to quote
+        Append_Utf8(mo->series, cs_cast(utf8), size);
+        return;
+    }
+
+    Append_Codepoint(mo->series, '"');
+    const REBYTE *segment = utf8;
+    for (cp = utf8; cp != end; ++cp) {
+        if (*cp != '"')
+            continue;
+        Append_Utf8(mo->series, cs_cast(segment), (cp + 1) - segment);
+        Append_Codepoint(mo->series, '"');  // double it
+        segment = cp + 1;
+    }
+    Append_Utf8(mo->series, cs_cast(segment), end - segment);
+    Append_Codepoint(mo->series, '"');
+}
+
+
+//
+//  export encode-csv: native [
+//
+//  {Make delimited text of a block of records (one line per record)}
+//
+//      return: [binary!]
+//      records "Block of BLOCK!s, BLANK! fields are left empty"
+//          [block!]
+//      /delimiter "Field separator (default is comma)"
+//          [char!]
+//  ]
+//
+REBNATIVE(encode_csv)
+//
+// Fields are quoted only if they have to be.  Lines end with LF.
+{
+    CSV_INCLUDE_PARAMS_OF_ENCODE_CSV;
+
+    REBYTE delimiter = ',';
+    if (REF(delimiter)) {
+        REBUNI c = VAL_CHAR(ARG(delimiter));
+        if (c >= 0x80 or c == '"' or c == CR or c == LF)
+            fail (PAR(delimiter));
+        delimiter = cast(REBYTE, c);
+    }
+
+    REBSPC *specifier = VAL_SPECIFIER(ARG(records));
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    RELVAL *record = VAL_ARRAY_AT(ARG(records));
+    for (; NOT_END(record); ++record) {
+        if (not IS_BLOCK(record))
+            fail (Error_Bad_Value_Core(record, specifier));
+
+        RELVAL *field = VAL_ARRAY_AT(record);
+        for (; NOT_END(field); ++field) {
+            if (field != VAL_ARRAY_AT(record))
+                Append_Codepoint(mo->series, delimiter);
+
+            if (IS_BLANK(field))
+                continue;
+
+            if (ANY_STRING(field) or ANY_WORD(field)) {
+                REBSIZ size;
+                const REBYTE *utf8 = VAL_UTF8_AT(&size, field);
+                Encode_Csv_Text(mo, utf8, size, delimiter);
+            }
+            else if (IS_INTEGER(field)) {
+                REBYTE buf[60];
+                REBINT len = Emit_Integer(buf, VAL_INT64(field));
+                Append_Ascii_Len(mo->series, s_cast(buf), len);
+            }
+            else {
+                if (ANY_ARRAY(field) or ANY_CONTEXT(field) or IS_MAP(field))
+                    fail (Error_Bad_Value_Core(
+                        field, Derive_Specifier(specifier, record)
+                    ));
+
+                REBSTR *formed = Copy_Mold_Or_Form_Value(field, 0, true);
+                Encode_Csv_Text(
+                    mo, STR_HEAD(formed), STR_SIZE(formed), delimiter
+                );
+                Free_Unmanaged_Series(SER(formed));
+            }
+        }
+        Append_Codepoint(mo->series, LF);
+    }
+
+    return Init_Binary(D_OUT, Pop_Molded_Binary(mo));
+}
@@ -232,6 +232,194 @@ int Wait_For_Device_Events_Interruptible(
 
 #define MAX_WAIT_MS 64 // Maximum millsec to sleep
 
+#define MAX_EVENTS_PER_AWAKE 8  // to prevent polling lockout
+
+
+//
+//  Wake_Up_Port: C
+//
+// Update a port with an event (if it has a native actor), then call the
+// port's AWAKE handler.  Returns true if the handler says the port woke up.
+//
+// The frame is used by native actors only for their output cell; ON-WAKE-UP
+// handlers operate on the `port` they are passed and do not re-read the
+// frame's arguments.  This lets the system port dispatcher share the code
+// with the WAKE-UP native without building a new frame for each event.
+//
+static bool Wake_Up_Port(REBFRM *frame_, REBVAL *port, const REBVAL *event)
+{
+    FAIL_IF_BAD_PORT(port);
+
+    REBCTX *ctx = VAL_CONTEXT(port);
+
+    REBVAL *actor = CTX_VAR(ctx, STD_PORT_ACTOR);
+    if (Is_Native_Port_Actor(actor)) {
+        //
+        // !!! Most of the R3-Alpha event model is around just as "life
+        // support".  Added assertion and convention here that this call
+        // doesn't throw or return meaningful data... (?)
+        //
+        DECLARE_LOCAL (verb);
+        Init_Word(verb, Canon(SYM_ON_WAKE_UP));
+        const REBVAL *r = Do_Port_Action(frame_, port, verb);
+        assert(IS_VOID(r));
+        UNUSED(r);
+    }
+
+    REBVAL *awake = CTX_VAR(ctx, STD_PORT_AWAKE);
+    if (not IS_ACTION(awake))
+        return true;  // no handler means the event is sufficient
+
+    const bool fully = true; // error if not all arguments consumed
+
+    if (RunQ_Throws(D_OUT, fully, rebU1(awake), event, rebEND))
+        fail (Error_No_Catch_For_Throw(D_OUT));
+
+    return IS_LOGIC(D_OUT) and VAL_LOGIC(D_OUT);
+}
+
+
+//
+//  Dispatch_System_Events: C
+//
+// Native equivalent of the usermode AWAKE that the system port used to have.
+// Queued events are routed straight to the awake handler of the port they
+// are for, with no interpreted loop (or AWAKE/ONLY path) in between.
+//
+// Returns the same codes as Awake_System():
+//     -1 for errors (or nothing to do)
+//      0 for nothing to do
+//      1 for wait is satisifed
+//
+static REBINT Dispatch_System_Events(
+    REBFRM *frame_,
+    REBVAL *sport,
+    REBARR *ports,
+    bool only
+){
+    REBCTX *sctx = VAL_CONTEXT(sport);
+
+    REBVAL *state = CTX_VAR(sctx, STD_PORT_STATE);  // event queue
+    REBVAL *waked = CTX_VAR(sctx, STD_PORT_DATA);  // pending awakes
+    if (not IS_BLOCK(state) or not IS_BLOCK(waked))
+        return -10;
+
+    if (VAL_LEN_HEAD(state) == 0 and VAL_LEN_HEAD(waked) == 0)
+        return -1;  // nothing new to do
+
+    if (only and not ports)
+        return 0;  // short cut for a pause
+
+    DECLARE_LOCAL (event);
+    DECLARE_LOCAL (port);
+    PUSH_GC_GUARD(event);
+    PUSH_GC_GUARD(port);
+
+    // Process all events (even if no awake ports).  The queue and wake list
+    // are refetched each time, because a port's AWAKE can call WAIT.
+    //
+    REBLEN n_event = 0;
+    REBLEN index = 0;
+    while (n_event <= MAX_EVENTS_PER_AWAKE) {
+        state = CTX_VAR(sctx, STD_PORT_STATE);
+        if (not IS_BLOCK(state) or index >= VAL_LEN_HEAD(state))
+            break;
+
+        Move_Value(event, KNOWN(ARR_AT(VAL_ARRAY(state), index)));
+        if (
+            not Get_Event_Var(port, event, Canon(SYM_PORT))
+            or not IS_PORT(port)
+        ){
+            fail (Error_Bad_Value(event));
+        }
+
+        if (
+            only
+            and Find_In_Array_Simple(ports, 0, port) == ARR_LEN(ports)
+        ){
+            ++index;  // leave events for other ports in the queue
+            continue;
+        }
+
+        // Remove before WAKE-UP to avoid overflow if its AWAKE calls WAIT
+        //
+        Remove_Series_Units(SER(VAL_ARRAY(state)), index, 1);
+
+        if (Wake_Up_Port(frame_, port, event)) {
+            waked = CTX_VAR(sctx, STD_PORT_DATA);
+            if (
+                IS_BLOCK(waked)
+                and Find_In_Array_Simple(VAL_ARRAY(waked), 0, port)
+                    == VAL_LEN_HEAD(waked)
+            ){
+                Append_Value(VAL_ARRAY(waked), port);
+            }
+        }
+        ++n_event;
+    }
+
+    DROP_GC_GUARD(port);
+    DROP_GC_GUARD(event);
+
+    if (not ports)
+        return 0;  // no wake ports (just a timer)
+
+    // Are any of the requested ports awake?
+    //
+    waked = CTX_VAR(sctx, STD_PORT_DATA);
+    if (not IS_BLOCK(waked))
+        return -10;
+
+    RELVAL *item = ARR_HEAD(ports);
+    for (; NOT_END(item); ++item) {
+        if (
+            IS_PORT(item)
+            and Find_In_Array_Simple(VAL_ARRAY(waked), 0, item)
+                != VAL_LEN_HEAD(waked)
+        ){
+            return 1;
+        }
+    }
+
+    return 0;  // keep waiting
+}
+
+
+//
+//  system-awake: native [
+//
+//  {Dispatch queued events of the system port to their ports' AWAKE}
+//
+//      return: [logic! blank!]
+//      sport "System port (State block holds events)"
+//          [port!]
+//      ports "Port list (Copy of block passed to WAIT)"
+//          [block! blank!]
+//      /only
+//  ]
+//
+REBNATIVE(system_awake)
+//
+// This is the default AWAKE of the system port.  WAIT recognizes it and
+// calls Dispatch_System_Events() directly, so it only runs as a native when
+// invoked explicitly (e.g. by an override that delegates to it).
+{
+    EVENT_INCLUDE_PARAMS_OF_SYSTEM_AWAKE;
+
+    REBARR *ports = IS_BLOCK(ARG(ports)) ? VAL_ARRAY(ARG(ports)) : nullptr;
+
+    REBINT ret = Dispatch_System_Events(
+        frame_,
+        ARG(sport),
+        ports,
+        did REF(only)
+    );
+    if (ret < 0 or (ret == 0 and not ports))
+        return Init_Blank(D_OUT);
+
+    return Init_Logic(D_OUT, ret > 0);
+}
+
 
 //
 //  Wait_Ports_Throws: C
@@ -241,11 +429,15 @@ int Wait_For_Device_Events_Interruptible(
 //     Timeout: milliseconds to wait
 //
 // Returns:
-//     out is LOGIC! TRUE when port action happened, or FALSE for timeout
-//     if a throw happens, out will be the thrown value and returns TRUE
+//     D_OUT is LOGIC! TRUE when port action happened, or FALSE for timeout
+//     if a throw happens, D_OUT will be the thrown value and returns TRUE
+//
+// The frame is that of the WAIT native.  Its output cell is used as scratch
+// space while dispatching events, so the caller must keep `ports` safe from
+// GC some other way.
 //
-bool Wait_Ports_Throws(
-    REBVAL *out,
+static bool Wait_Ports_Throws(
+    REBFRM *frame_,
     REBARR *ports,
     REBLEN timeout,
     bool only
@@ -261,16 +453,12 @@ bool Wait_Ports_Throws(
     assert(Saved_State != NULL);
 
     while (wt) {
-        if (GET_SIGNAL(SIG_HALT)) {
-            CLR_SIGNAL(SIG_HALT);
-
-            Init_Thrown_With_Label(out, NULLED_CELL, NAT_VALUE(halt));
+        if (TAKE_SIGNAL(SIG_HALT)) {
+            Init_Thrown_With_Label(D_OUT, NULLED_CELL, NAT_VALUE(halt));
             return true; // thrown
         }
 
-        if (GET_SIGNAL(SIG_INTERRUPT)) {
-            CLR_SIGNAL(SIG_INTERRUPT);
-
+        if (TAKE_SIGNAL(SIG_INTERRUPT)) {
             // !!! If implemented, this would allow triggering a breakpoint
             // with a keypress.  This needs to be thought out a bit more,
             // but may not involve much more than running `BREAKPOINT`.
@@ -278,11 +466,27 @@ bool Wait_Ports_Throws(
             fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
         }
 
+        // Process any waiting events.  If the system port's AWAKE is still
+        // the default native, dispatch directly; only an AWAKE which has
+        // been overridden is called through the evaluator.
+        //
         REBINT ret;
+        REBVAL *sport = Get_System(SYS_PORTS, PORTS_SYSTEM);
+        REBVAL *awake = IS_PORT(sport)
+            ? CTX_VAR(VAL_CONTEXT(sport), STD_PORT_AWAKE)
+            : nullptr;
+        if (
+            awake
+            and IS_ACTION(awake)
+            and VAL_ACT_DISPATCHER(awake) == &N_EVENT_system_awake
+        ){
+            ret = Dispatch_System_Events(frame_, sport, ports, only);
+        }
+        else
+            ret = Awake_System(ports, only);
 
-        // Process any waiting events:
-        if ((ret = Awake_System(ports, only)) > 0) {
-            Move_Value(out, TRUE_VALUE); // port action happened
+        if (ret > 0) {
+            Move_Value(D_OUT, TRUE_VALUE); // port action happened
             return false; // not thrown
         }
 
@@ -296,9 +500,11 @@ bool Wait_Ports_Throws(
         if (not IS_BLOCK(pump))
             fail ("system/ports/pump must be a block");
 
-        DECLARE_LOCAL (result);
-        if (Do_Any_Array_At_Throws(result, pump, SPECIFIED))
-            fail (Error_No_Catch_For_Throw(result));
+        if (VAL_LEN_AT(pump) != 0) {  // usually empty, don't push a frame
+            DECLARE_LOCAL (result);
+            if (Do_Any_Array_At_Throws(result, pump, SPECIFIED))
+                fail (Error_No_Catch_For_Throw(result));
+        }
 
         if (timeout != ALL_BITS) {
             // Figure out how long that (and OS_WAIT) took:
@@ -316,7 +522,7 @@ bool Wait_Ports_Throws(
     //time = (REBLEN)Delta_Time(base);
     //Print("dt: %d", time);
 
-    Move_Value(out, FALSE_VALUE); // timeout;
+    Move_Value(D_OUT, FALSE_VALUE); // timeout;
     return false; // not thrown
 }
 
@@ -395,14 +601,15 @@ REBNATIVE(wait)
         }
     }
 
-    // Prevent GC on temp port block:
+    // Prevent GC on temp port block.  D_OUT is used as scratch space by the
+    // event dispatch, but the original argument is no longer needed.
     // Note: Port block is always a copy of the block.
     //
     if (ports)
-        Init_Block(D_OUT, ports);
+        Init_Block(ARG(value), ports);
 
     // Process port events [stack-move]:
-    if (Wait_Ports_Throws(D_OUT, ports, timeout, did REF(only)))
+    if (Wait_Ports_Throws(frame_, ports, timeout, did REF(only)))
         return R_THROWN;
 
     assert(IS_LOGIC(D_OUT));
@@ -418,15 +625,14 @@ REBNATIVE(wait)
     // Determine what port(s) waked us:
     Sieve_Ports(ports);
 
-    if (not REF(all)) {
-        val = ARR_HEAD(ports);
-        if (not IS_PORT(val))
-            return nullptr;
+    if (REF(all))
+        RETURN (ARG(value));  // holds the sieved `ports` block
 
-        Move_Value(D_OUT, KNOWN(val));
-    }
+    val = ARR_HEAD(ports);
+    if (not IS_PORT(val))
+        return nullptr;
 
-    return D_OUT;
+    RETURN (KNOWN(val));
 }
 
 
@@ -447,39 +653,9 @@ REBNATIVE(wake_up)
 {
     EVENT_INCLUDE_PARAMS_OF_WAKE_UP;
 
-    FAIL_IF_BAD_PORT(ARG(port));
-
-    REBCTX *ctx = VAL_CONTEXT(ARG(port));
-
-    REBVAL *actor = CTX_VAR(ctx, STD_PORT_ACTOR);
-    if (Is_Native_Port_Actor(actor)) {
-        //
-        // We don't pass `actor` or `event` in, because we just pass the
-        // current call info.  The port action can re-read the arguments.
-        //
-        // !!! Most of the R3-Alpha event model is around just as "life
-        // support".  Added assertion and convention here that this call
-        // doesn't throw or return meaningful data... (?)
-        //
-        DECLARE_LOCAL (verb);
-        Init_Word(verb, Canon(SYM_ON_WAKE_UP));
-        const REBVAL *r = Do_Port_Action(frame_, ARG(port), verb);
-        assert(IS_VOID(r));
-        UNUSED(r);
-    }
-
-    bool woke_up = true; // start by assuming success
-
-    REBVAL *awake = CTX_VAR(ctx, STD_PORT_AWAKE);
-    if (IS_ACTION(awake)) {
-        const bool fully = true; // error if not all arguments consumed
-
-        if (RunQ_Throws(D_OUT, fully, rebU1(awake), ARG(event), rebEND))
-            fail (Error_No_Catch_For_Throw(D_OUT));
-
-        if (not (IS_LOGIC(D_OUT) and VAL_LOGIC(D_OUT)))
-            woke_up = false;
-    }
+    // We don't pass `actor` in, because we just pass the current call info.
+    //
+    bool woke_up = Wake_Up_Port(frame_, ARG(port), ARG(event));
 
     return Init_Logic(D_OUT, woke_up);
 }
@@ -156,6 +156,7 @@ extern REB_R TO_Event(REBVAL *out, enum Reb_Kind kind, const REBVAL *arg);
 extern void MF_Event(REB_MOLD *mo, const REBCEL *v, bool form);
 extern REBTYPE(Event);
 extern REB_R PD_Event(REBPVS *pvs, const REBVAL *picker, const REBVAL *opt_setval);
+extern REBVAL *Get_Event_Var(RELVAL *out, const REBCEL *v, REBSTR *name);
 
 // !!! The port scheme is also being included in the extension.
 
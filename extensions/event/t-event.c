@@ -237,7 +237,7 @@ void Set_Event_Vars(REBVAL *evt, RELVAL *blk, REBSPC *specifier)
 //
 // Will return BLANK! if the variable is not available.
 //
-static REBVAL *Get_Event_Var(RELVAL *out, const REBCEL *v, REBSTR *name)
+REBVAL *Get_Event_Var(RELVAL *out, const REBCEL *v, REBSTR *name)
 {
     switch (STR_SYMBOL(name)) {
       case SYM_TYPE: {
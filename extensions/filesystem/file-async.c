@@ -0,0 +1,459 @@
+//
+//  File: %file-async.c
+//  Summary: "Worker threads for file reads that shouldn't block the caller"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// A read() of a file can block for a long time (a slow disk, a network
+// mount), and reading thousands of small files is dominated by the latency
+// of each open()/read()/close().  Handing the calls to a pool of threads
+// lets the interpreter keep running in the first case, and keeps many
+// requests in flight to the OS in the second.
+//
+// A File_Job is one read, either of `length` bytes from an open descriptor
+// into a buffer the caller provides, or of a whole file by its local path
+// into a buffer malloc()'d by the worker.  Workers only make system calls
+// and touch the job...they make no API calls, so they never run into the GC
+// or the evaluator.  The caller must not touch a job (or the buffer it reads
+// into) until it is done.
+//
+// The threads are started the first time a job is submitted, and then sleep
+// waiting for more work until the process exits.  A child made by fork() has
+// none of them, so it starts over with its own.  If none can be started
+// (or the platform has no pthreads), jobs are run as they are submitted.
+//
+// A job that was still in flight when the process forked is the parent's,
+// and is never finished in the child.  So the child fails it with ECANCELED
+// the first time it is checked on: an async port READ inherited that way
+// gets an ERROR event (and can be closed) instead of being waited on forever.
+// READ-FILES can't be affected, as it waits for its jobs before returning.
+//
+// !!! Linux's io_uring could submit a batch of reads in one system call, but
+// would need liburing or the raw syscalls and kernel headers, and it is often
+// blocked in containers.  Submit_File_Jobs() is where such a backend would go.
+//
+
+#include <string.h>
+#include <stdlib.h>  // malloc(), since workers can't use rebAlloc()
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include "sys-core.h"
+
+#include "file-req.h"
+
+#if defined(FILE_USE_PTHREADS)
+    #include <pthread.h>
+#endif
+
+#ifndef O_BINARY
+    #define O_BINARY 0
+#endif
+
+#define FILE_MIN_THREADS 4  // reads wait on devices more than on the CPU
+#define FILE_MAX_THREADS 32
+
+
+static struct {
+    struct File_Job *head;  // queue of jobs not yet picked up by a worker
+    struct File_Job *tail;
+    int num_threads;  // -1 until the first job is submitted
+    unsigned int generation;  // bumped in forked children, to orphan jobs
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_t lock;  // guards everything, including jobs' `done`
+    pthread_cond_t work_cond;  // signaled when jobs are queued
+    pthread_cond_t done_cond;  // signaled when a batch's countdown hits 0
+  #endif
+} File_Pool = {
+    nullptr,
+    nullptr,
+    -1,
+    0
+  #if defined(FILE_USE_PTHREADS)
+    , PTHREAD_MUTEX_INITIALIZER
+    , PTHREAD_COND_INITIALIZER
+    , PTHREAD_COND_INITIALIZER
+  #endif
+};
+
+
+//
+//  Read_Fully: C
+//
+// Like read(), but keep going after short reads until `length` bytes or the
+// end of the file.  Returns bytes read, or -1 with errno set.
+//
+static ssize_t Read_Fully(int fd, unsigned char *data, size_t length)
+{
+    size_t actual = 0;
+    while (actual < length) {
+        ssize_t bytes = read(fd, data + actual, length - actual);
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        if (bytes == 0)
+            break;  // end of file
+        actual += bytes;
+    }
+    return actual;
+}
+
+
+//
+//  Read_Whole_File: C
+//
+// Size the buffer by fstat() if the file says how big it is, else grow it
+// as the data comes in (e.g. for files in /proc, which report 0).
+//
+static void Read_Whole_File(struct File_Job *job)
+{
+    int fd = open(job->path, O_RDONLY | O_BINARY);
+    if (fd < 0) {
+        job->error = errno;
+        return;
+    }
+
+    struct stat info;
+    size_t capacity = 4096;
+    if (fstat(fd, &info) == 0 and info.st_size > 0)
+        capacity = cast(size_t, info.st_size) + 1;  // +1 notices growth
+
+    job->data = cast(unsigned char*, malloc(capacity));
+    job->actual = 0;
+
+    while (job->data) {
+        ssize_t bytes = Read_Fully(
+            fd, job->data + job->actual, capacity - job->actual
+        );
+        if (bytes < 0) {
+            job->error = errno;
+            break;
+        }
+        job->actual += bytes;
+        if (job->actual < capacity)
+            break;  // end of file
+
+        unsigned char *bigger = cast(unsigned char*,
+            realloc(job->data, capacity * 2)
+        );
+        if (not bigger)
+            free(job->data);
+        job->data = bigger;
+        capacity *= 2;
+    }
+
+    if (not job->data)
+        job->error = ENOMEM;
+    else if (job->error != 0) {
+        free(job->data);
+        job->data = nullptr;
+    }
+
+    close(fd);
+}
+
+
+//
+//  Run_File_Job: C
+//
+static void Run_File_Job(struct File_Job *job)
+{
+    job->error = 0;
+
+    if (job->path) {
+        Read_Whole_File(job);
+        return;
+    }
+
+    ssize_t bytes = Read_Fully(job->fd, job->data, job->length);
+    if (bytes < 0) {
+        job->error = errno;
+        job->actual = 0;
+    }
+    else
+        job->actual = bytes;
+}
+
+
+//
+//  Finish_File_Job: C
+//
+// Caller must hold the pool's lock (if there are threads).
+//
+static void Finish_File_Job(struct File_Job *job)
+{
+    job->done = true;
+    if (job->countdown and --*job->countdown == 0) {
+      #if defined(FILE_USE_PTHREADS)
+        pthread_cond_broadcast(&File_Pool.done_cond);
+      #endif
+    }
+}
+
+
+#if defined(FILE_USE_PTHREADS)
+
+//
+//  File_Worker: C
+//
+static void *File_Worker(void *arg)
+{
+    UNUSED(arg);
+
+    pthread_mutex_lock(&File_Pool.lock);
+    while (true) {
+        struct File_Job *job = File_Pool.head;
+        if (not job) {
+            pthread_cond_wait(&File_Pool.work_cond, &File_Pool.lock);
+            continue;
+        }
+
+        File_Pool.head = job->next;
+        if (not File_Pool.head)
+            File_Pool.tail = nullptr;
+
+        pthread_mutex_unlock(&File_Pool.lock);
+        Run_File_Job(job);
+        pthread_mutex_lock(&File_Pool.lock);
+
+        Finish_File_Job(job);
+    }
+    return nullptr;  // never reached
+}
+
+
+//
+//  Lock_File_Pool_Before_Fork: C
+//
+// A fork() only copies the thread calling it, so the child could get the
+// lock held by a worker that doesn't exist there.  Holding it across the
+// fork means the child gets it in a known state (and the queue unchanged).
+//
+static void Lock_File_Pool_Before_Fork(void)
+{
+    pthread_mutex_lock(&File_Pool.lock);
+}
+
+static void Unlock_File_Pool_After_Fork(void)
+{
+    pthread_mutex_unlock(&File_Pool.lock);
+}
+
+
+//
+//  Reset_File_Pool_In_Child: C
+//
+// The child has none of the parent's workers, so it starts over with no pool
+// (its threads are started again if it submits a job).  Jobs the parent had
+// in flight are the parent's business, and aren't finished in the child...
+// a new generation marks them as orphaned.
+//
+static void Reset_File_Pool_In_Child(void)
+{
+    File_Pool.head = nullptr;
+    File_Pool.tail = nullptr;
+    File_Pool.num_threads = -1;
+    ++File_Pool.generation;
+
+    pthread_mutex_init(&File_Pool.lock, nullptr);
+    pthread_cond_init(&File_Pool.work_cond, nullptr);
+    pthread_cond_init(&File_Pool.done_cond, nullptr);
+}
+
+
+//
+//  Start_File_Workers: C
+//
+// Caller must hold the pool's lock.
+//
+static void Start_File_Workers(void)
+{
+    static bool registered = false;  // fork handlers are inherited by children
+    if (not registered) {
+        pthread_atfork(
+            &Lock_File_Pool_Before_Fork,
+            &Unlock_File_Pool_After_Fork,
+            &Reset_File_Pool_In_Child
+        );
+        registered = true;
+    }
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int num_threads = cpus < 1 ? FILE_MIN_THREADS : cast(int, cpus * 2);
+    if (num_threads < FILE_MIN_THREADS)
+        num_threads = FILE_MIN_THREADS;
+    if (num_threads > FILE_MAX_THREADS)
+        num_threads = FILE_MAX_THREADS;
+
+    File_Pool.num_threads = 0;
+    for (; File_Pool.num_threads < num_threads; ++File_Pool.num_threads) {
+        pthread_t thread;
+        if (pthread_create(&thread, nullptr, &File_Worker, nullptr) != 0)
+            break;  // the ones that did start will share the work
+        pthread_detach(thread);
+    }
+}
+
+#endif
+
+
+//
+//  Submit_File_Jobs: C
+//
+// Queue an array of jobs for the workers.  Jobs sharing a countdown form a
+// batch, whose countdown must be set to the number of jobs in it.
+//
+void Submit_File_Jobs(struct File_Job *jobs, REBLEN num_jobs)
+{
+    if (num_jobs == 0)
+        return;
+
+    REBLEN i;
+    for (i = 0; i < num_jobs; ++i) {
+        jobs[i].done = false;
+        jobs[i].generation = File_Pool.generation;
+        jobs[i].next = (i + 1 < num_jobs) ? &jobs[i + 1] : nullptr;
+    }
+
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_lock(&File_Pool.lock);
+
+    if (File_Pool.num_threads < 0)
+        Start_File_Workers();
+
+    if (File_Pool.num_threads > 0) {
+        if (File_Pool.tail)
+            File_Pool.tail->next = &jobs[0];
+        else
+            File_Pool.head = &jobs[0];
+        File_Pool.tail = &jobs[num_jobs - 1];
+
+        if (num_jobs == 1)
+            pthread_cond_signal(&File_Pool.work_cond);
+        else
+            pthread_cond_broadcast(&File_Pool.work_cond);
+
+        pthread_mutex_unlock(&File_Pool.lock);
+        return;
+    }
+
+    pthread_mutex_unlock(&File_Pool.lock);
+  #else
+    File_Pool.num_threads = 0;
+  #endif
+
+    for (i = 0; i < num_jobs; ++i) {  // no workers, so do the jobs now
+        Run_File_Job(&jobs[i]);
+        Finish_File_Job(&jobs[i]);
+    }
+}
+
+
+#if defined(FILE_USE_PTHREADS)
+
+//
+//  Cancel_If_Orphaned: C
+//
+// If a job was submitted before this process was forked and isn't done, no
+// worker here will ever do it, so finish it as canceled.  Only single reads
+// into a caller's buffer can be orphaned this way (a batch is waited on by
+// whoever submitted it).  Caller must hold the pool's lock.
+//
+static void Cancel_If_Orphaned(struct File_Job *job)
+{
+    if (job->done or job->generation == File_Pool.generation)
+        return;
+
+    assert(job->countdown == nullptr and job->path == nullptr);
+    job->error = ECANCELED;
+    job->actual = 0;
+    job->done = true;
+}
+
+#endif
+
+
+//
+//  Is_File_Job_Done: C
+//
+// Once this returns true, the job's results (and buffer) may be used.
+//
+bool Is_File_Job_Done(struct File_Job *job)
+{
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_lock(&File_Pool.lock);
+    Cancel_If_Orphaned(job);
+    bool done = job->done;
+    pthread_mutex_unlock(&File_Pool.lock);
+    return done;
+  #else
+    return job->done;
+  #endif
+}
+
+
+//
+//  Wait_File_Jobs: C
+//
+// Block until every job in a batch is done.
+//
+void Wait_File_Jobs(REBLEN *countdown)
+{
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_lock(&File_Pool.lock);
+    while (*countdown != 0)
+        pthread_cond_wait(&File_Pool.done_cond, &File_Pool.lock);
+    pthread_mutex_unlock(&File_Pool.lock);
+  #else
+    assert(*countdown == 0);  // jobs were run as they were submitted
+  #endif
+}
+
+
+//
+//  Wait_File_Job: C
+//
+// Block until a single job (not part of a batch) is done.
+//
+void Wait_File_Job(struct File_Job *job)
+{
+    assert(job->countdown == nullptr);
+
+    REBLEN countdown = Is_File_Job_Done(job) ? 0 : 1;
+    if (countdown == 0)
+        return;
+
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_lock(&File_Pool.lock);
+    Cancel_If_Orphaned(job);
+    if (job->done)
+        countdown = 0;
+    else
+        job->countdown = &countdown;  // worker decrements and signals
+    while (countdown != 0)
+        pthread_cond_wait(&File_Pool.done_cond, &File_Pool.lock);
+    job->countdown = nullptr;
+    pthread_mutex_unlock(&File_Pool.lock);
+  #endif
+}
@@ -47,6 +47,7 @@
 #endif
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/types.h>
@@ -55,12 +56,17 @@
 #include <dirent.h>
 #include <errno.h>
 #include <assert.h>
+#include <sys/uio.h>  // writev()
 
 #include <time.h>
 #ifndef timeval
     #include <sys/time.h>  // for older systems
 #endif
 
+#if defined(__linux__)
+    #include <sys/sendfile.h>
+#endif
+
 #include "sys-core.h"
 
 #include "file-req.h"
@@ -73,6 +79,24 @@
     #define PATH_MAX 4096  // generally lacking in Posix
 #endif
 
+// copy_file_range() is in Linux 4.5 and up, but only declared by glibc 2.27
+// and up.  (On older kernels it fails with ENOSYS, so falls back.)
+//
+#if defined(__linux__) && defined(__GLIBC__) && ( \
+    __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27) \
+)
+    #define USE_COPY_FILE_RANGE
+#endif
+
+#define COPY_CHUNK_MAX (1 << 30)  // most any one copy system call moves
+#define COPY_BUFFER_SIZE (64 * 1024)  // when copying through a buffer
+
+#define WRITE_IOV_MAX 64  // pieces per writev() (POSIX only promises 16...)
+#if defined(IOV_MAX) && IOV_MAX < WRITE_IOV_MAX
+    #undef WRITE_IOV_MAX
+    #define WRITE_IOV_MAX IOV_MAX  // ...but IOV_MAX is 1024 on Linux and BSD
+#endif
+
 
 // The BSD legacy names S_IREAD/S_IWRITE are not defined several places.
 // That includes building on Android, or if you compile as C99.
@@ -303,23 +327,24 @@ static int Read_Directory(REBREQ *dir, REBREQ *file)
 
     file_req->modes = 0;
 
-#if 0
-    // NOTE: we do not use d_type even if DT_DIR is #define-d.  First of all,
-    // it's not a POSIX requirement and not all operating systems support it.
-    // (Linux/BSD have it defined in their structs, but Haiku doesn't--for
-    // instance).  But secondly, even if your OS supports it...a filesystem
-    // doesn't have to.  (Examples: VirtualBox shared folders, XFS.)
-
+    // dirent.d_type saves a stat() per entry, but it is a BSD extension and
+    // not in POSIX.  Not all systems have it (e.g. Haiku), and those that do
+    // may say DT_UNKNOWN when the filesystem doesn't know (e.g. VirtualBox
+    // shared folders, some XFS).  Symbolic links say DT_LNK, but READ tells
+    // what they point to.  So the more widely supported (but less efficient)
+    // stat() is used when the type isn't definitely known.
+    //
+  #if defined(DT_DIR)
     if (d->d_type == DT_DIR)
         file_req->modes |= RFM_DIR;
-#endif
-
-    // More widely supported mechanism of determining if something is a
-    // directory, although less efficient than DT_DIR (because it requires
-    // making an additional filesystem call)
-
+    else if (d->d_type == DT_UNKNOWN or d->d_type == DT_LNK) {
+        if (Is_Dir(dir_utf8, file_utf8))
+            file_req->modes |= RFM_DIR;
+    }
+  #else
     if (Is_Dir(dir_utf8, file_utf8))
         file_req->modes |= RFM_DIR;
+  #endif
 
     ReqFile(file)->path = rebValue(
         "applique 'local-to-file [",
@@ -433,6 +458,23 @@ DEVICE_CMD Close_File(REBREQ *file)
 {
     struct rebol_devreq *req = Req(file);
 
+    // A worker may still be reading from the descriptor, so wait for it
+    // before closing.  The data is dropped, with no event for the port.
+    //
+    struct File_Job *job = ReqFile(file)->job;
+    if (job) {
+        Wait_File_Job(job);
+        ReqFile(file)->job = nullptr;
+        free(job);
+
+        OS_Abort_Device(file);  // take off the pending list
+
+        CLEAR_SERIES_INFO(VAL_BINARY(req->common.binary), HOLD);
+        rebRelease(req->common.binary);
+        TRASH_POINTER_IF_DEBUG(req->common.binary);
+        req->modes &= ~RFM_ASYNC;
+    }
+
     if (req->requestee.id) {
         close(req->requestee.id);
         req->requestee.id = 0;
@@ -441,6 +483,31 @@ DEVICE_CMD Close_File(REBREQ *file)
 }
 
 
+//
+//  Poll_Async_Read: C
+//
+// An RFM_ASYNC read leaves its request on the device's pending list, so it
+// is called again each time WAIT polls devices.  Once the worker is done,
+// the port gets its data and a READ event (or an ERROR event).
+//
+static int Poll_Async_Read(REBREQ *file)
+{
+    struct File_Job *job = ReqFile(file)->job;
+    if (not Is_File_Job_Done(job))
+        return DR_PEND;
+
+    ReqFile(file)->job = nullptr;
+
+    int errnum = job->error;
+    Req(file)->actual = job->actual;
+    ReqFile(file)->index += job->actual;
+    free(job);
+
+    Finish_Async_Read(file, errnum);
+    return DR_DONE;
+}
+
+
 //
 //  Read_File: C
 //
@@ -455,6 +522,9 @@ DEVICE_CMD Read_File(REBREQ *file)
         );
     }
 
+    if (ReqFile(file)->job)  // polled while a worker thread does the read
+        return Poll_Async_Read(file);
+
     assert(req->requestee.id != 0);
 
     if ((req->modes & (RFM_SEEK | RFM_RESEEK)) != 0) {
@@ -463,6 +533,26 @@ DEVICE_CMD Read_File(REBREQ *file)
             rebFail_OS (errno);
     }
 
+    if (req->modes & RFM_ASYNC) {
+        // Not rebAlloc(), which would be freed if this frame failed.
+        //
+        struct File_Job *job = cast(struct File_Job*,
+            malloc(sizeof(struct File_Job))
+        );
+        if (not job)
+            rebFail_OS (ENOMEM);
+
+        job->path = nullptr;
+        job->fd = req->requestee.id;
+        job->data = req->common.data;
+        job->length = req->length;
+        job->countdown = nullptr;
+
+        ReqFile(file)->job = job;
+        Submit_File_Jobs(job, 1);
+        return DR_PEND;  // pending list polls us until the job is done
+    }
+
     // printf("read %d len %d\n", req->requestee.id, req->length);
 
     ssize_t bytes = read(
@@ -478,6 +568,66 @@ DEVICE_CMD Read_File(REBREQ *file)
 }
 
 
+//
+//  Write_Pieces: C
+//
+// Write a BLOCK! of BINARY! and TEXT! (see RFM_PIECES) with writev(), which
+// takes WRITE_IOV_MAX pieces per call.  A partial write picks up where it
+// left off, partway into a piece if need be.
+//
+static void Write_Pieces(REBREQ *file)
+{
+    struct rebol_devreq *req = Req(file);
+
+    RELVAL *head = VAL_ARRAY_AT(req->common.binary);
+    REBLEN num_pieces = VAL_LEN_AT(req->common.binary);
+
+    REBLEN i = 0;  // first piece not completely written
+    size_t skip = 0;  // bytes of it that were written
+
+    while (i < num_pieces) {
+        struct iovec iov[WRITE_IOV_MAX];
+        int count = 0;
+
+        REBLEN n;
+        for (n = i; n < num_pieces and count < WRITE_IOV_MAX; ++n) {
+            REBSIZ size;
+            const REBYTE *bytes = VAL_BYTES_AT(&size, head + n);
+            if (n == i) {
+                bytes += skip;
+                size -= skip;
+            }
+            if (size == 0)
+                continue;
+            iov[count].iov_base = m_cast(REBYTE*, bytes);
+            iov[count].iov_len = size;
+            ++count;
+        }
+        if (count == 0)
+            break;  // only empty pieces left
+
+        ssize_t bytes = writev(req->requestee.id, iov, count);
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            rebFail_OS (errno);
+        }
+        req->actual += bytes;
+
+        size_t written = bytes;  // now find where the write stopped
+        for (; i < num_pieces; ++i, skip = 0) {
+            REBSIZ size;
+            VAL_BYTES_AT(&size, head + i);
+            if (size - skip > written) {
+                skip += written;
+                break;
+            }
+            written -= size - skip;
+        }
+    }
+}
+
+
 //
 //  Write_File: C
 //
@@ -506,6 +656,12 @@ DEVICE_CMD Write_File(REBREQ *file)
 
     req->actual = 0;  // count actual bytes written as we go along
 
+    if (req->modes & RFM_PIECES) {
+        req->modes &= ~RFM_PIECES;
+        Write_Pieces(file);
+        return DR_DONE;
+    }
+
     if (req->length == 0)
         return DR_DONE;
 
@@ -702,6 +858,201 @@ DEVICE_CMD Rename_File(REBREQ *file)
 }
 
 
+//
+//  Copy_File_Data: C
+//
+// Copy from one descriptor's position to another's, until the end of the
+// input or `limit` bytes (if not negative).  The fastest way the system
+// offers is used, falling back on the next when one isn't supported:
+//
+// * copy_file_range() copies inside the kernel, and on filesystems that
+//   share extents (btrfs, XFS, NFS 4.2) may not copy the data at all.  It
+//   fails with EXDEV across filesystems before Linux 5.3.
+//
+// * sendfile() copies inside the kernel, from the input's page cache.
+//
+// * read() and write() through a buffer, which works everywhere.
+//
+// All use and advance the descriptors' own positions, so switching methods
+// partway is fine.  Returns 0, or an errno value.
+//
+static int Copy_File_Data(int in, int out, REBI64 limit, REBI64 *copied)
+{
+  #if defined(__linux__)
+    enum {
+        COPY_RANGE,
+        COPY_SENDFILE,
+        COPY_BUFFERED
+    } method = COPY_RANGE;
+  #endif
+
+    unsigned char *buffer = nullptr;
+    int errnum = 0;
+
+    *copied = 0;
+    while (limit < 0 or *copied < limit) {
+        size_t len = COPY_CHUNK_MAX;
+        if (limit >= 0 and cast(REBU64, limit - *copied) < len)
+            len = cast(size_t, limit - *copied);
+
+        ssize_t bytes;
+
+      #if defined(USE_COPY_FILE_RANGE)
+        if (method == COPY_RANGE) {
+            bytes = copy_file_range(in, nullptr, out, nullptr, len, 0);
+            if (bytes < 0 and (
+                errno == ENOSYS or errno == EXDEV or errno == EINVAL
+                or errno == EOPNOTSUPP
+                or errno == EBADF  // e.g. the output was opened O_APPEND
+            )){
+                method = COPY_SENDFILE;
+                continue;
+            }
+            if (bytes == 0 and *copied == 0) {  // some kernels do for /proc
+                method = COPY_SENDFILE;
+                continue;
+            }
+        }
+        else
+      #endif
+      #if defined(__linux__)
+        if (method != COPY_BUFFERED) {
+            bytes = sendfile(out, in, nullptr, len);
+            if (bytes < 0 and (errno == ENOSYS or errno == EINVAL)) {
+                method = COPY_BUFFERED;
+                continue;
+            }
+        }
+        else
+      #endif
+        {
+            if (not buffer) {
+                buffer = cast(unsigned char*, malloc(COPY_BUFFER_SIZE));
+                if (not buffer)
+                    return ENOMEM;
+            }
+            if (len > COPY_BUFFER_SIZE)
+                len = COPY_BUFFER_SIZE;
+
+            bytes = read(in, buffer, len);
+
+            ssize_t written = 0;
+            while (written < bytes) {
+                ssize_t w = write(out, buffer + written, bytes - written);
+                if (w < 0 and errno == EINTR)
+                    continue;
+                if (w < 0) {
+                    bytes = -1;
+                    break;
+                }
+                written += w;
+            }
+        }
+
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            errnum = errno;
+            break;
+        }
+        if (bytes == 0)
+            break;  // end of input
+
+        *copied += bytes;
+    }
+
+    free(buffer);
+    return errnum;
+}
+
+
+//
+//  Copy_File_May_Fail: C
+//
+// Copy the contents of one file to another, without reading them into a
+// BINARY!.  The target is created with the source's permissions if it
+// doesn't exist, else truncated (unless it is the source, which is an
+// error).  Returns the number of bytes copied.
+//
+REBI64 Copy_File_May_Fail(
+    const REBVAL *source,
+    const REBVAL *target,
+    REBI64 limit  // negative for no limit
+){
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, source);
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_WRITE, target);
+
+    char *source_utf8 = rebSpell("file-to-local/full", source, rebEND);
+    int in = open(source_utf8, O_RDONLY | O_BINARY);
+    rebFree(source_utf8);
+
+    if (in < 0)
+        rebFail_OS (errno);
+
+    struct stat info;
+    int errnum = 0;
+    if (fstat(in, &info) != 0)
+        errnum = errno;
+    else if (S_ISDIR(info.st_mode))
+        errnum = EISDIR;
+
+    if (errnum != 0) {
+        close(in);
+        rebFail_OS (errnum);
+    }
+
+    // The target isn't opened with O_TRUNC, as it may be the source under
+    // another name (or the same one), which truncating would destroy.  So it
+    // is checked first and truncated after.
+    //
+    char *target_utf8 = rebSpell("file-to-local/full", target, rebEND);
+    int out = open(
+        target_utf8,
+        O_WRONLY | O_CREAT | O_BINARY,
+        info.st_mode & 0777
+    );
+    rebFree(target_utf8);
+
+    if (out < 0) {
+        errnum = errno;
+        close(in);
+        rebFail_OS (errnum);
+    }
+
+    struct stat out_info;
+    bool same = false;
+    if (fstat(out, &out_info) != 0)
+        errnum = errno;
+    else if (
+        out_info.st_dev == info.st_dev and out_info.st_ino == info.st_ino
+    ){
+        same = true;
+    }
+    else if (ftruncate(out, 0) != 0)
+        errnum = errno;
+
+    if (same or errnum != 0) {
+        close(in);
+        close(out);
+        if (same)
+            fail ("Cannot copy a file onto itself");
+        rebFail_OS (errnum);
+    }
+
+    REBI64 copied;
+    errnum = Copy_File_Data(in, out, limit, &copied);
+
+    close(in);
+    if (close(out) != 0 and errnum == 0)  // e.g. NFS reports errors late
+        errnum = errno;
+
+    if (errnum != 0)
+        rebFail_OS (errnum);
+
+    return copied;
+}
+
+
 //
 //  Get_Timezone: C
 //
@@ -753,6 +1104,17 @@ static int Get_Timezone(struct tm *utc_tm_unused)
 }
 
 
+//
+//  Get_File_Timezone: C
+//
+// The time zone File_Time_To_Rebol() gives dates, for code making many.
+//
+int Get_File_Timezone(void)
+{
+    return Get_Timezone(nullptr);
+}
+
+
 //
 //  File_Time_To_Rebol: C
 //
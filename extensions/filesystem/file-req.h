@@ -21,6 +21,7 @@ struct devreq_file {
     int64_t size;           // file size
     int64_t index;          // file index position
     FILETIME_DEVREQ time;   // file modification time (struct)
+    struct File_Job *job;   // asynchronous read in progress (or NULL)
 };
 
 inline static struct devreq_file* ReqFile(REBREQ *req) {
@@ -30,6 +31,51 @@ inline static struct devreq_file* ReqFile(REBREQ *req) {
 
 extern REBVAL *File_Time_To_Rebol(REBREQ *file);
 extern REBVAL *Query_File_Or_Dir(const REBVAL *port, REBREQ *file);
+extern void Finish_Async_Read(REBREQ *file, int errnum);
+
+
+// A read done by a worker thread (see %file-async.c).  Either `path` is the
+// local name of a file to read whole into a malloc()'d `data`, or `path` is
+// NULL and up to `length` bytes are read from `fd` into the given `data`.
+//
+struct File_Job {
+    struct File_Job *next;  // used by the worker pool's queue
+    const char *path;
+    int fd;
+    unsigned char *data;
+    size_t length;
+    size_t actual;  // bytes read
+    int error;  // errno value if the read failed, else 0
+    bool done;
+    REBLEN *countdown;  // jobs left in this one's batch, or NULL
+    unsigned int generation;  // of the pool it was submitted to, see forks
+};
+
+// Worker threads for file I/O are only on POSIX, and not Emscripten (which
+// can only have pthreads with special build settings).
+//
+#if !defined(TO_WINDOWS) && !defined(TO_EMSCRIPTEN)
+    #define FILE_USE_PTHREADS
+#endif
+
+#if !defined(TO_WINDOWS)
+    extern void Submit_File_Jobs(struct File_Job *jobs, REBLEN num_jobs);
+    extern bool Is_File_Job_Done(struct File_Job *job);
+    extern void Wait_File_Jobs(REBLEN *countdown);
+    extern void Wait_File_Job(struct File_Job *job);
+
+    extern int Get_File_Timezone(void);
+    extern REBI64 Copy_File_May_Fail(
+        const REBVAL *source,
+        const REBVAL *target,
+        REBI64 limit
+    );
+    extern REBARR *Walk_Dir_May_Fail(
+        const REBVAL *path,
+        bool info,
+        REBINT num_workers
+    );
+#endif
 
 #ifdef TO_WINDOWS
     #define OS_DIR_SEP '\\'  // file path separator (Thanks Bill.)
@@ -0,0 +1,549 @@
+//
+//  File: %file-walk.c
+//  Summary: "Recursive directory listing in one pass, optionally threaded"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Listing a big tree with a READ per directory pays for a device request,
+// a FILE-TO-LOCAL and LOCAL-TO-FILE per entry, and a stat() per entry just
+// to find out which ones are directories...then a QUERY per entry to get
+// the sizes and dates.  WALK-DIR does the whole tree natively instead:
+//
+// * Types come from dirent.d_type where the filesystem fills it in, so a
+//   listing without /INFO usually makes no stat() calls at all.
+//
+// * Directories are opened with openat() relative to the root's descriptor,
+//   and entries are stat()'d with fstatat() relative to their directory's.
+//   So no full path strings are built for the system calls, and the kernel
+//   doesn't walk the path from the root for every entry.
+//
+// * Several threads can read directories at once, taking them from a shared
+//   stack as they are found.  Workers make no API calls; they fill in C
+//   structures which the main thread turns into values when all are done.
+//   The result is in the same order whatever the number of threads.
+//
+// Symbolic links are reported as what they point to (as READ and QUERY do),
+// but not followed into, so a link can't cause a cycle.
+//
+
+// openat(), fstatat() and fdopendir() are POSIX.1-2008, d_type is BSD
+//
+#define _POSIX_C_SOURCE 200809L
+#ifndef __cplusplus
+    #define _GNU_SOURCE  // redundant under C++
+#endif
+
+#include <string.h>
+#include <stdlib.h>  // malloc(), since workers can't use rebAlloc()
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <errno.h>
+#include <time.h>
+
+#include "sys-core.h"
+
+#include "file-req.h"
+
+#if defined(FILE_USE_PTHREADS)
+    #include <pthread.h>
+#endif
+
+#ifndef O_DIRECTORY
+    #define O_DIRECTORY 0
+#endif
+
+#ifndef O_CLOEXEC
+    #define O_CLOEXEC 0
+#endif
+
+#define WALK_MAX_WORKERS 64  // more just contend for the lock and the disk
+
+
+struct Walk_Entry {
+    size_t name;  // offset of the name in the directory's `names`
+    bool is_dir;
+    int64_t size;  // only with /INFO
+    int64_t mtime;  // seconds since 1970 UTC, only with /INFO
+    struct Walk_Dir *subdir;  // contents, if a directory that was entered
+};
+
+struct Walk_Dir {
+    struct Walk_Dir *next;  // in the stack of directories left to read
+    char *path;  // relative to the root, ending in '/' (or "" for the root)
+    char *names;  // NUL-terminated names of the entries, end to end
+    size_t names_used;
+    size_t names_capacity;
+    struct Walk_Entry *entries;
+    size_t num_entries;
+    size_t entries_capacity;
+    bool out_of_memory;  // listing is incomplete
+};
+
+struct Walk {
+    int root_fd;
+    bool info;
+    struct Walk_Dir *stack;  // directories found but not read yet
+    int busy;  // workers reading a directory (which may add to the stack)
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;  // signaled when the stack grows, or all are done
+  #endif
+};
+
+
+//
+//  Make_Walk_Dir: C
+//
+static struct Walk_Dir *Make_Walk_Dir(
+    const char *parent,
+    size_t parent_size,
+    const char *name,
+    size_t name_size
+){
+    struct Walk_Dir *dir = cast(struct Walk_Dir*,
+        malloc(sizeof(struct Walk_Dir))
+    );
+    if (not dir)
+        return nullptr;
+
+    dir->path = cast(char*, malloc(parent_size + name_size + 2));
+    if (not dir->path) {
+        free(dir);
+        return nullptr;
+    }
+    memcpy(dir->path, parent, parent_size);
+    memcpy(dir->path + parent_size, name, name_size);
+    if (name_size != 0)
+        dir->path[parent_size + name_size++] = '/';
+    dir->path[parent_size + name_size] = '\0';
+
+    dir->next = nullptr;
+    dir->names = nullptr;
+    dir->names_used = 0;
+    dir->names_capacity = 0;
+    dir->entries = nullptr;
+    dir->num_entries = 0;
+    dir->entries_capacity = 0;
+    dir->out_of_memory = false;
+    return dir;
+}
+
+
+//
+//  Free_Walk_Dir: C
+//
+static void Free_Walk_Dir(struct Walk_Dir *dir)
+{
+    size_t i;
+    for (i = 0; i < dir->num_entries; ++i) {
+        if (dir->entries[i].subdir)
+            Free_Walk_Dir(dir->entries[i].subdir);
+    }
+    free(dir->entries);
+    free(dir->names);
+    free(dir->path);
+    free(dir);
+}
+
+
+//
+//  Add_Walk_Entry: C
+//
+// Returns NULL if out of memory.
+//
+static struct Walk_Entry *Add_Walk_Entry(
+    struct Walk_Dir *dir,
+    const char *name,
+    size_t name_size
+){
+    if (dir->num_entries == dir->entries_capacity) {
+        size_t capacity = dir->entries_capacity ? dir->entries_capacity * 2 : 16;
+        struct Walk_Entry *entries = cast(struct Walk_Entry*,
+            realloc(dir->entries, capacity * sizeof(struct Walk_Entry))
+        );
+        if (not entries)
+            return nullptr;
+        dir->entries = entries;
+        dir->entries_capacity = capacity;
+    }
+
+    if (dir->names_used + name_size + 1 > dir->names_capacity) {
+        size_t capacity = dir->names_capacity ? dir->names_capacity * 2 : 256;
+        while (dir->names_used + name_size + 1 > capacity)
+            capacity *= 2;
+        char *names = cast(char*, realloc(dir->names, capacity));
+        if (not names)
+            return nullptr;
+        dir->names = names;
+        dir->names_capacity = capacity;
+    }
+
+    struct Walk_Entry *entry = &dir->entries[dir->num_entries++];
+    entry->name = dir->names_used;
+    memcpy(dir->names + dir->names_used, name, name_size + 1);
+    dir->names_used += name_size + 1;
+
+    entry->is_dir = false;
+    entry->size = 0;
+    entry->mtime = 0;
+    entry->subdir = nullptr;
+    return entry;
+}
+
+
+//
+//  Read_Walk_Dir: C
+//
+// List one directory, returning the subdirectories to go into next as a
+// linked list.  If the directory can't be read (e.g. no permission), it
+// is listed in its parent with nothing in it.
+//
+static struct Walk_Dir *Read_Walk_Dir(struct Walk *walk, struct Walk_Dir *dir)
+{
+    int fd = openat(
+        walk->root_fd,
+        dir->path[0] == '\0' ? "." : dir->path,
+        O_RDONLY | O_DIRECTORY | O_CLOEXEC
+    );
+    if (fd < 0)
+        return nullptr;
+
+    DIR *h = fdopendir(fd);  // takes ownership of fd, closedir() closes it
+    if (not h) {
+        close(fd);
+        return nullptr;
+    }
+
+    size_t path_size = strlen(dir->path);
+    struct Walk_Dir *subdirs = nullptr;
+
+    struct dirent *d;
+    while ((d = readdir(h)) != nullptr) {
+        const char *name = d->d_name;
+        if (
+            name[0] == '.'
+            and (name[1] == '\0' or (name[1] == '.' and name[2] == '\0'))
+        ){
+            continue;
+        }
+
+        // See notes in Read_Directory() on when d_type can be trusted.
+        //
+        struct stat info;
+        bool have_info = false;
+        bool is_dir;
+        bool enter;
+
+      #if defined(DT_DIR)
+        if (d->d_type == DT_DIR) {
+            is_dir = true;
+            enter = true;
+        }
+        else if (d->d_type != DT_UNKNOWN and d->d_type != DT_LNK) {
+            is_dir = false;
+            enter = false;
+        }
+        else
+      #endif
+        {
+            if (fstatat(fd, name, &info, AT_SYMLINK_NOFOLLOW) != 0)
+                continue;  // removed since readdir(), so don't list it
+
+            enter = S_ISDIR(info.st_mode);
+            if (S_ISLNK(info.st_mode))  // report the target, unless dangling
+                fstatat(fd, name, &info, 0);
+            is_dir = S_ISDIR(info.st_mode);
+            have_info = true;
+        }
+
+        if (walk->info and not have_info) {
+            if (
+                fstatat(fd, name, &info, 0) != 0
+                and fstatat(fd, name, &info, AT_SYMLINK_NOFOLLOW) != 0
+            ){
+                continue;  // removed since readdir()
+            }
+            have_info = true;
+        }
+
+        size_t name_size = strlen(name);
+        struct Walk_Entry *entry = Add_Walk_Entry(dir, name, name_size);
+        if (not entry) {
+            dir->out_of_memory = true;
+            break;
+        }
+
+        entry->is_dir = is_dir;
+        if (have_info) {
+            entry->size = is_dir ? 0 : cast(int64_t, info.st_size);
+            entry->mtime = cast(int64_t, info.st_mtime);
+        }
+
+        if (enter) {
+            struct Walk_Dir *subdir = Make_Walk_Dir(
+                dir->path, path_size, name, name_size
+            );
+            if (not subdir) {
+                dir->out_of_memory = true;
+                break;
+            }
+            entry->subdir = subdir;
+            subdir->next = subdirs;
+            subdirs = subdir;
+        }
+    }
+
+    closedir(h);
+    return subdirs;
+}
+
+
+//
+//  Walk_Worker: C
+//
+// Read directories off the stack until it is empty and no other worker is
+// in the middle of a directory (which could find more).  Run by each thread,
+// including the main one.
+//
+static void *Walk_Worker(void *arg)
+{
+    struct Walk *walk = cast(struct Walk*, arg);
+
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_lock(&walk->lock);
+  #endif
+
+    while (true) {
+        struct Walk_Dir *dir = walk->stack;
+        if (not dir) {
+            if (walk->busy == 0)
+                break;  // nothing left, and nobody can add more
+
+          #if defined(FILE_USE_PTHREADS)
+            pthread_cond_wait(&walk->cond, &walk->lock);
+          #endif
+            continue;
+        }
+
+        walk->stack = dir->next;
+        ++walk->busy;
+
+      #if defined(FILE_USE_PTHREADS)
+        pthread_mutex_unlock(&walk->lock);
+      #endif
+
+        struct Walk_Dir *subdirs = Read_Walk_Dir(walk, dir);
+
+      #if defined(FILE_USE_PTHREADS)
+        pthread_mutex_lock(&walk->lock);
+      #endif
+
+        --walk->busy;
+
+        if (subdirs) {
+            struct Walk_Dir *last = subdirs;
+            while (last->next)
+                last = last->next;
+            last->next = walk->stack;
+            walk->stack = subdirs;
+        }
+
+      #if defined(FILE_USE_PTHREADS)
+        if (subdirs or walk->busy == 0)
+            pthread_cond_broadcast(&walk->cond);
+      #endif
+    }
+
+  #if defined(FILE_USE_PTHREADS)
+    pthread_mutex_unlock(&walk->lock);
+  #endif
+
+    return nullptr;
+}
+
+
+struct Walk_Push {
+    struct Walk_Dir *root;
+    bool info;
+    int zone;
+    char *buffer;  // for building paths
+    size_t buffer_capacity;
+};
+
+
+//
+//  Push_Walk_Dir: C
+//
+// Each entry's path is followed by its size and date if /INFO, and the
+// contents of a subdirectory come right after the subdirectory's own entry.
+//
+static void Push_Walk_Dir(struct Walk_Push *push, struct Walk_Dir *dir)
+{
+    if (dir->out_of_memory)
+        fail (Error_No_Memory(0));
+
+    size_t path_size = strlen(dir->path);
+
+    size_t i;
+    for (i = 0; i < dir->num_entries; ++i) {
+        struct Walk_Entry *entry = &dir->entries[i];
+        const char *name = dir->names + entry->name;
+        size_t name_size = strlen(name);
+
+        size_t size = path_size + name_size + 1;
+        if (size > push->buffer_capacity) {
+            char *bigger = cast(char*, realloc(push->buffer, size * 2));
+            if (not bigger)
+                fail (Error_No_Memory(size * 2));
+            push->buffer = bigger;
+            push->buffer_capacity = size * 2;
+        }
+        memcpy(push->buffer, dir->path, path_size);
+        memcpy(push->buffer + path_size, name, name_size);
+        size = path_size + name_size;
+        if (entry->is_dir)
+            push->buffer[size++] = '/';
+
+        Init_File(DS_PUSH(), Make_Sized_String_UTF8(push->buffer, size));
+
+        if (push->info) {
+            Init_Integer(DS_PUSH(), entry->size);
+
+            time_t stime = cast(time_t, entry->mtime);
+            struct tm utc_tm;
+            gmtime_r(&stime, &utc_tm);
+
+            REBVAL *date = DS_PUSH();
+            RESET_CELL(date, REB_DATE, CELL_MASK_NONE);
+            VAL_YEAR(date) = utc_tm.tm_year + 1900;
+            VAL_MONTH(date) = utc_tm.tm_mon + 1;
+            VAL_DAY(date) = utc_tm.tm_mday;
+            VAL_DATE(date).zone = push->zone / ZONE_MINS;
+            PAYLOAD(Time, date).nanoseconds = SECS_TO_NANO(
+                utc_tm.tm_hour * 3600 + utc_tm.tm_min * 60 + utc_tm.tm_sec
+            );
+        }
+
+        if (entry->subdir)
+            Push_Walk_Dir(push, entry->subdir);
+    }
+}
+
+
+// Making values can fail (e.g. a name that isn't valid UTF-8), and the C
+// structures must be freed either way.
+//
+static REBVAL *Push_Walk_Dangerous(struct Walk_Push *push) {
+    Push_Walk_Dir(push, push->root);
+    return nullptr;
+}
+
+
+//
+//  Walk_Dir_May_Fail: C
+//
+// Implementation of WALK-DIR for POSIX.  If `num_workers` is 0, there is one
+// per CPU core.  Either way there are at most WALK_MAX_WORKERS.
+//
+REBARR *Walk_Dir_May_Fail(const REBVAL *path, bool info, REBINT num_workers)
+{
+    char *path_utf8 = rebSpell("file-to-local/full", path, rebEND);
+    int root_fd = open(path_utf8, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    rebFree(path_utf8);
+
+    if (root_fd < 0)
+        rebFail_OS (errno);
+
+    struct Walk walk;
+    walk.root_fd = root_fd;
+    walk.info = info;
+    walk.busy = 0;
+    walk.stack = Make_Walk_Dir("", 0, "", 0);
+    if (not walk.stack) {
+        close(root_fd);
+        fail (Error_No_Memory(sizeof(struct Walk_Dir)));
+    }
+    struct Walk_Dir *root = walk.stack;
+
+  #if defined(FILE_USE_PTHREADS)
+    if (num_workers == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_workers = cpus < 1 ? 1 : cast(REBINT, cpus);
+    }
+    if (num_workers > WALK_MAX_WORKERS)
+        num_workers = WALK_MAX_WORKERS;
+
+    pthread_mutex_init(&walk.lock, nullptr);
+    pthread_cond_init(&walk.cond, nullptr);
+
+    // The main thread is a worker too, so start one fewer thread.  If a
+    // thread can't be started, the others pick up its share.
+    //
+    pthread_t *threads = rebAllocN(pthread_t, num_workers);
+    REBINT num_started = 0;
+    for (; num_started < num_workers - 1; ++num_started) {
+        int err = pthread_create(
+            &threads[num_started], nullptr, &Walk_Worker, &walk
+        );
+        if (err != 0)
+            break;
+    }
+
+    Walk_Worker(&walk);
+
+    REBINT t;
+    for (t = 0; t < num_started; ++t)
+        pthread_join(threads[t], nullptr);
+
+    rebFree(threads);
+    pthread_cond_destroy(&walk.cond);
+    pthread_mutex_destroy(&walk.lock);
+  #else
+    UNUSED(num_workers);
+
+    Walk_Worker(&walk);
+  #endif
+
+    close(root_fd);
+
+    struct Walk_Push push;
+    push.root = root;
+    push.info = info;
+    push.zone = info ? Get_File_Timezone() : 0;
+    push.buffer = nullptr;
+    push.buffer_capacity = 0;
+
+    REBDSP dsp_orig = DSP;
+
+    REBVAL *error = rebRescue(cast(REBDNG*, &Push_Walk_Dangerous), &push);
+
+    free(push.buffer);
+    Free_Walk_Dir(root);
+
+    if (error) {
+        REBCTX *ctx = VAL_CONTEXT(error);
+        rebRelease(error);
+        fail (ctx);
+    }
+
+    return Pop_Stack_Values(dsp_orig);
+}
@@ -374,6 +374,36 @@ DEVICE_CMD Read_File(REBREQ *file)
 }
 
 
+//
+//  Write_Pieces: C
+//
+// Write a BLOCK! of BINARY! and TEXT! (see RFM_PIECES) a piece at a time.
+//
+// !!! WriteFileGather() only works on files opened without buffering, with
+// every piece a whole number of pages.  So this is one WriteFile() per piece,
+// which at least avoids JOINing the pieces first.
+//
+static void Write_Pieces(REBREQ *file)
+{
+    struct rebol_devreq *req = Req(file);
+    req->actual = 0;
+
+    RELVAL *item = VAL_ARRAY_AT(req->common.binary);
+    for (; NOT_END(item); ++item) {
+        REBSIZ size;
+        const REBYTE *bytes = VAL_BYTES_AT(&size, item);
+        if (size == 0)
+            continue;
+
+        DWORD written;
+        if (not WriteFile(req->requestee.handle, bytes, size, &written, 0))
+            rebFail_OS (GetLastError());
+
+        req->actual += written;
+    }
+}
+
+
 //
 //  Write_File: C
 //
@@ -398,6 +428,12 @@ DEVICE_CMD Write_File(REBREQ *file)
             SetEndOfFile(req->requestee.handle);
     }
 
+    if (req->modes & RFM_PIECES) {
+        req->modes &= ~RFM_PIECES;
+        Write_Pieces(file);
+        return DR_DONE;
+    }
+
     // !!! We now are operating on the belief that CR LF does not count in the
     // nominal idea of what a "text" file format is, so any CRs in the file
     // trigger the need to use special codec settings or to write the file as
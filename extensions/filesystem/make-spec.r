@@ -20,7 +20,11 @@ depends: compose [
             ; Other options exist, e.g. "aio.h"
             ; https://fwheel.net/aio.html
             ;
-            [%filesystem/file-posix.c]
+            [
+                %filesystem/file-posix.c
+                %filesystem/file-async.c
+                %filesystem/file-walk.c
+            ]
         ]
     ])
 
@@ -29,6 +33,17 @@ depends: compose [
     ])
 ]
 
+libraries: compose [
+    ;
+    ; Asynchronous READ, READ-FILES and WALK-DIR use worker threads (see
+    ; FILE_USE_PTHREADS in %file-req.h).  Android has pthreads in its libc,
+    ; and Windows reads on the calling thread for now.
+    ;
+    (if not find [Windows Android Emscripten] system-config/os-base [
+        %pthread
+    ])
+]
+
 ldflags: compose [
     (if "1" = get-env "USE_FCNTL_NOT_FCNTL64" [
         {-Wl,--wrap=fcntl64}
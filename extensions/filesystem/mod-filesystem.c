@@ -585,6 +585,241 @@ REBNATIVE(change_dir)
 }
 
 
+#if !defined(TO_WINDOWS)
+
+struct Read_Files_Push {
+    struct File_Job *jobs;
+    REBLEN num_files;
+    REBLEN num_pushed;  // jobs whose buffers have been freed
+};
+
+// Making the binaries can fail (e.g. out of memory, or under BUDGET), and the
+// buffers malloc()'d by the workers for the rest must be freed either way.
+//
+static REBVAL *Push_Read_Files_Dangerous(struct Read_Files_Push *push) {
+    for (; push->num_pushed < push->num_files; ++push->num_pushed) {
+        struct File_Job *job = &push->jobs[push->num_pushed];
+        if (job->error != 0) {
+            REBVAL *error = rebError_OS(job->error);
+            Move_Value(DS_PUSH(), error);
+            rebRelease(error);
+            continue;
+        }
+
+        REBBIN *bin = Make_Binary(job->actual);
+        memcpy(BIN_HEAD(bin), job->data, job->actual);
+        TERM_BIN_LEN(bin, job->actual);
+        free(job->data);
+        job->data = nullptr;
+
+        Init_Binary(DS_PUSH(), bin);
+    }
+    return nullptr;
+}
+
+#endif
+
+
+//
+//  export read-files: native [
+//
+//  {Read many whole files at once, with many reads in flight to the OS}
+//
+//      return: "BINARY! for each file, or ERROR! if it couldn't be read"
+//          [block!]
+//      files [block!]
+//          "FILE!s to read"
+//  ]
+//
+REBNATIVE(read_files)
+//
+// Where reading a lot of small files one after another spends most of its
+// time waiting on each open() and read(), this submits them all to the
+// worker threads of %file-async.c and waits for the whole batch.
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_READ_FILES;
+
+    REBVAL *files = ARG(files);
+
+  #if defined(TO_WINDOWS)
+    //
+    // !!! No worker threads for files on Windows yet, so just READ each.
+    //
+    return rebValue(
+        "map-each file", files, "[",
+            "(func [r] [either error? r [r] [first r]])",
+                "entrap [read file]",
+        "]",
+    rebEND);
+  #else
+    REBLEN num_files = VAL_LEN_AT(files);
+    struct File_Job *jobs = rebAllocN(struct File_Job, num_files + 1);  // +1
+    REBLEN countdown = num_files;
+
+    // Local paths are kept alive on the data stack while the workers read
+    // their UTF-8 directly.  (This thread waits, so there can be no GC.)
+    //
+    REBDSP dsp_orig = DSP;
+
+    RELVAL *item = VAL_ARRAY_AT(files);
+    REBLEN i;
+    for (i = 0; i < num_files; ++i, ++item) {
+        if (not IS_FILE(item))
+            fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(files)));
+
+        DECLARE_LOCAL (file);
+        Derelativize(file, item, VAL_SPECIFIER(files));
+        Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, file);
+
+        REBSTR *local = To_Local_Path(file, REB_FILETOLOCAL_FULL);
+        Init_Text(DS_PUSH(), local);
+
+        struct File_Job *job = &jobs[i];
+        job->path = STR_UTF8(local);
+        job->data = nullptr;
+        job->countdown = &countdown;
+    }
+
+    Submit_File_Jobs(jobs, num_files);
+    Wait_File_Jobs(&countdown);
+
+    DS_DROP_TO(dsp_orig);
+
+    struct Read_Files_Push push;
+    push.jobs = jobs;
+    push.num_files = num_files;
+    push.num_pushed = 0;
+
+    REBVAL *error = rebRescue(cast(REBDNG*, &Push_Read_Files_Dangerous), &push);
+
+    for (i = push.num_pushed; i < num_files; ++i)
+        free(jobs[i].data);  // free(nullptr) is a no-op, e.g. on errors
+
+    rebFree(jobs);
+
+    if (error) {
+        REBCTX *ctx = VAL_CONTEXT(error);
+        rebRelease(error);
+        fail (ctx);
+    }
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+  #endif
+}
+
+
+//
+//  export walk-dir: native [
+//
+//  {Recursively list the files and directories in a directory, in one pass}
+//
+//      return: "Paths relative to DIR, each followed by size and date if /INFO"
+//          [block!]
+//      dir [file!]
+//      /info "Include each entry's size (0 for directories) and modified date"
+//      /workers "Threads reading directories (default one per core, max 64)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(walk_dir)
+//
+// A directory's contents come right after its own entry, so the result is in
+// the same order whatever the number of workers.  See %file-walk.c.
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_WALK_DIR;
+
+    REBVAL *dir = ARG(dir);
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, dir);
+
+    REBINT num_workers = 0;  // let the walker decide
+    if (REF(workers)) {
+        num_workers = VAL_INT32(ARG(workers));
+        if (num_workers < 1)
+            fail (Error_Out_Of_Range(ARG(workers)));
+    }
+
+  #if defined(TO_WINDOWS)
+    UNUSED(num_workers);
+
+    // !!! No native walker on Windows yet, so READ and QUERY each directory.
+    //
+    return rebValue(
+        "use [out walk] [",
+            "out: copy []",
+            "walk: func [dir prefix] [",
+                "for-each f read dir [",
+                    "append out join prefix f",
+                    "if", rebL(REF(info)), "[",
+                        "append out either dir? f [0] [",
+                            "(query join dir f)/size",
+                        "]",
+                        "append out (query join dir f)/date",
+                    "]",
+                    "if dir? f [walk join dir f join prefix f]",
+                "]",
+            "]",
+            "walk dirize", dir, "%\"\"",
+            "out",
+        "]",
+    rebEND);
+  #else
+    return Init_Block(
+        D_OUT,
+        Walk_Dir_May_Fail(dir, REF(info), num_workers)
+    );
+  #endif
+}
+
+
+//
+//  export copy-file: native [
+//
+//  {Copy a file's contents to another file, without reading it into memory}
+//
+//      return: "Number of bytes copied"
+//          [integer!]
+//      source [file!]
+//      target "Made with the source's permissions if new, else truncated"
+//          [file!]
+//      /part "Copy at most this many bytes"
+//          [integer!]
+//  ]
+//
+REBNATIVE(copy_file)
+//
+// This is also what `write target source` does when the source is a FILE!.
+{
+    FILESYSTEM_INCLUDE_PARAMS_OF_COPY_FILE;
+
+    if (REF(part) and VAL_INT64(ARG(part)) < 0)
+        fail (Error_Out_Of_Range(ARG(part)));
+
+  #if defined(TO_WINDOWS)
+    //
+    // !!! CopyFileEx() would copy without reading into memory, but has no
+    // limit for /PART.  Just READ and WRITE for now.  (That wouldn't lose a
+    // file copied onto itself, but it is an error on POSIX, so it is here.)
+    //
+    return rebValue(
+        "use [bin] [",
+            "if (clean-path", ARG(source), ") = (clean-path", ARG(target), ") [",
+                "fail {Cannot copy a file onto itself}",
+            "]",
+            "bin: read/part", ARG(source), rebQ1(REF(part)),
+            "write", ARG(target), "bin",
+            "length of bin",
+        "]",
+    rebEND);
+  #else
+    REBI64 limit = REF(part) ? VAL_INT64(ARG(part)) : -1;
+    return Init_Integer(
+        D_OUT,
+        Copy_File_May_Fail(ARG(source), ARG(target), limit)
+    );
+  #endif
+}
+
+
 extern REBVAL *Get_Current_Exec();
 
 //
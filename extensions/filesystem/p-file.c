@@ -184,6 +184,117 @@ static void Read_File_Port(
 }
 
 
+//
+//  Read_File_Port_Async: C
+//
+// READ on an open file port that has an AWAKE handler returns right away,
+// while a worker thread does the read (see %file-async.c).  The data goes
+// into a BINARY! that is held read-only until filled, and then becomes the
+// port's DATA as a READ event is queued.
+//
+static void Read_File_Port_Async(REBREQ *file, REBLEN len)
+{
+    struct rebol_devreq *req = Req(file);
+
+    REBSER *ser = Make_Binary(len);
+    TERM_BIN_LEN(ser, 0);  // length is set when the read finishes
+    SET_SERIES_INFO(ser, HOLD);
+
+    req->common.data = BIN_HEAD(ser);
+    req->common.binary = Init_Binary(Alloc_Value(), ser);
+    rebUnmanage(req->common.binary);  // outlives this frame if pending
+    req->length = len;
+    req->modes |= RFM_ASYNC;
+
+    REBVAL *result = OS_DO_DEVICE(file, RDC_READ);
+    if (result == nullptr)
+        return;  // pending, Finish_Async_Read() will be called when done
+
+    if (rebDid("error?", result, rebEND)) {
+        CLEAR_SERIES_INFO(ser, HOLD);
+        rebRelease(req->common.binary);
+        TRASH_POINTER_IF_DEBUG(req->common.binary);
+        req->modes &= ~RFM_ASYNC;
+        rebJumps("FAIL", result, rebEND);
+    }
+
+    rebRelease(result);
+    Finish_Async_Read(file, 0);  // device read it synchronously
+}
+
+
+//
+//  Finish_Async_Read: C
+//
+// Deliver the result of an RFM_ASYNC read to the port, as an event.  Like
+// the network ports, errors become an ERROR event with the port's ERROR set,
+// since raising them here (while WAIT is polling) would escape any TRAP
+// around the READ.
+//
+void Finish_Async_Read(REBREQ *file, int errnum)
+{
+    struct rebol_devreq *req = Req(file);
+    assert(req->modes & RFM_ASYNC);
+    req->modes &= ~RFM_ASYNC;
+
+    REBVAL *binary = req->common.binary;
+    TRASH_POINTER_IF_DEBUG(req->common.binary);
+    TRASH_POINTER_IF_DEBUG(req->common.data);
+
+    REBSER *ser = VAL_SERIES(binary);
+    CLEAR_SERIES_INFO(ser, HOLD);
+    SET_SERIES_LEN(ser, errnum == 0 ? req->actual : 0);
+    TERM_SEQUENCE(ser);
+
+    REBVAL *port = CTX_ARCHETYPE(CTX(ReqPortCtx(file)));
+
+    if (errnum != 0) {
+        rebElide(
+            "(", port, ")/error:", rebR(rebError_OS(errnum)),
+
+            "insert system/ports/system make event! [",
+                "type: 'error",
+                "port:", port,
+            "]",
+        rebEND);
+    }
+    else {
+        rebElide(
+            "(", port, ")/data:", binary,
+
+            "insert system/ports/system make event! [",
+                "type: 'read",
+                "port:", port,
+            "]",
+        rebEND);
+    }
+
+    rebRelease(binary);
+}
+
+
+//
+//  Is_Block_Of_Pieces: C
+//
+// A BLOCK! with at least one BINARY! in it and nothing but BINARY! and TEXT!
+// is written as the pieces' bytes, one after another.  Other blocks are
+// FORM'd, as they always were.  (FORM of a BINARY! is its source notation,
+// which was of no use in a file.)
+//
+static bool Is_Block_Of_Pieces(const REBVAL *block)
+{
+    bool any_binary = false;
+    RELVAL *item = VAL_ARRAY_AT(block);
+    for (; NOT_END(item); ++item) {
+        if (IS_BINARY(item))
+            any_binary = true;
+        else if (not IS_TEXT(item))
+            return false;
+    }
+    return any_binary;
+}
+
+
 //
 //  Write_File_Port: C
 //
@@ -194,6 +305,35 @@ static void Write_File_Port(REBREQ *file, REBVAL *data, REBLEN len, bool lines)
 {
     struct rebol_devreq *req = Req(file);
 
+    if (IS_BLOCK(data) and not lines and Is_Block_Of_Pieces(data)) {
+        //
+        // Each piece is written where it is, so they don't have to be JOINed
+        // into one BINARY! first (with writev(), where available).  TEXT! is
+        // written as its UTF-8, which has the same rule against CR as WRITE
+        // of a TEXT! has.
+        //
+        REBSIZ total = 0;
+        RELVAL *item = VAL_ARRAY_AT(data);
+        for (; NOT_END(item); ++item) {
+            REBSIZ size;
+            const REBYTE *bytes = VAL_BYTES_AT(&size, item);
+            if (IS_TEXT(item)) {
+                const REBYTE *cr = cast(const REBYTE*, memchr(bytes, CR, size));
+                if (cr)
+                    fail (Error_Illegal_Cr(cr, bytes));
+            }
+            total += size;
+        }
+
+        req->common.binary = data;  // safe, as the write is synchronous
+        req->length = total;
+        req->modes |= RFM_PIECES;
+        req->modes &= ~RFM_TEXT;
+
+        OS_DO_DEVICE_SYNC(file, RDC_WRITE);
+        return;
+    }
+
     if (IS_BLOCK(data)) {
         // Form the values of the block
         // !! Could be made more efficient if we broke the FORM
@@ -298,6 +438,22 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
     // !!! R3-Alpha never implemented quite a number of operations on files,
     // including FLUSH, POKE, etc.
 
+    // While a worker thread reads (see Read_File_Port_Async()), the request
+    // stays on the device's pending list to be polled.  Other commands would
+    // take it over, so only CLOSE is allowed until the READ event comes.
+    //
+    if (req->modes & RFM_ASYNC) {
+        switch (VAL_WORD_SYM(verb)) {
+          case SYM_REFLECT:
+          case SYM_ON_WAKE_UP:
+          case SYM_CLOSE:
+            break;
+
+          default:
+            fail ("File port has a READ in progress (WAIT for it, or CLOSE)");
+        }
+    }
+
     switch (VAL_WORD_SYM(verb)) {
       case SYM_REFLECT: {
         INCLUDE_PARAMS_OF_REFLECT;
@@ -372,6 +528,12 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
             Set_Seek(file, ARG(seek));
 
         REBLEN len = Set_Length(file, REF(part) ? VAL_INT64(ARG(part)) : -1);
+
+        if (not opened and IS_ACTION(CTX_VAR(ctx, STD_PORT_AWAKE))) {
+            Read_File_Port_Async(file, len);
+            RETURN (port);
+        }
+
         Read_File_Port(D_OUT, port, file, path, flags, len);
 
         if (opened) {
@@ -388,6 +550,9 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
 
         return D_OUT; }
 
+      case SYM_ON_WAKE_UP:  // an asynchronous READ finished
+        return Init_Void(D_OUT);
+
       case SYM_APPEND:
         //
         // !!! This is hacky, but less hacky than falling through to SYM_WRITE
@@ -404,7 +569,34 @@ REB_R File_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         if (REF(allow))
             fail (Error_Bad_Refines_Raw());
 
-        REBVAL *data = ARG(data); // binary, string, or block
+        REBVAL *data = ARG(data); // binary, string, block, or file
+
+        if (IS_FILE(data)) {
+            //
+            // `write %target %source` copies the file, without reading it
+            // into memory (see Copy_File_May_Fail()).  Otherwise the source
+            // is just READ, e.g. for WRITE/APPEND or an already open port.
+            //
+          #if !defined(TO_WINDOWS)
+            if (
+                not (req->flags & RRF_OPEN)
+                and not REF(seek) and not REF(append) and not REF(lines)
+            ){
+                Copy_File_May_Fail(
+                    data,
+                    path,
+                    REF(part) ? Int64s(ARG(part), 0) : -1
+                );
+                RETURN (port);
+            }
+          #endif
+
+            REBVAL *bin = rebValue(
+                "read/part", data, rebQ1(REF(part)),
+            rebEND);
+            Move_Value(data, bin);
+            rebRelease(bin);
+        }
 
         // Handle the WRITE %file shortcut case, where the FILE! is converted
         // to a PORT! but it hasn't been opened yet.
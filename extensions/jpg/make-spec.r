@@ -29,3 +29,13 @@ depends: [
 includes: [
     %prep/extensions/jpg
 ]
+libraries: compose [
+    ;
+    ; DECODE-JPEGS spreads a batch of images across threads.  Android has
+    ; pthreads in its libc, and Windows and Emscripten decode the batch on
+    ; one thread (see JPG_USE_PTHREADS in %mod-jpg.c).
+    ;
+    (if not find [Windows Android Emscripten] system-config/os-base [
+        %pthread
+    ])
+]
@@ -28,14 +28,69 @@
 
 #include "sys-core.h"
 
+#if !defined(TO_WINDOWS) && !defined(TO_EMSCRIPTEN)
+    #define JPG_USE_PTHREADS
+    #include <pthread.h>
+    #include <unistd.h>  // sysconf(), for counting CPUs
+#endif
+
 #include "tmp-mod-jpg.h"
 
 // These routines live in %u-jpg.c, which doesn't depend on %sys-core.h, but
 // has a minor dependency on %reb-c.h
+//
+// Decodes report errors by longjmp()ing to the `jump` buffer passed in, or
+// to the global `jpeg_state` if it is NULL.  Giving each decode its own
+// buffer is what lets DECODE-JPEGS run several of them at once on threads.
 
 extern jmp_buf jpeg_state;
 extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info_scaled(
+    char *buffer, int nbytes, int scale_denom, jmp_buf *jump, int *w, int *h
+);
+extern void jpeg_load_rgba(
+    char *buffer, int nbytes, int scale_denom, int fast, jmp_buf *jump,
+    char *output
+);
+
+
+//
+//  Jpeg_Scale_Denom: C
+//
+// The IDCT can only scale by 1/1, 1/2, 1/4 and 1/8 (a full 8x8 block, or a
+// 4x4, 2x2 or 1x1 block computed from its lowest frequencies).
+//
+static int Jpeg_Scale_Denom(const REBVAL *scale)
+{
+    if (IS_NULLED(scale))
+        return 1;
+
+    REBINT denom = VAL_INT32(scale);
+    if (denom != 1 and denom != 2 and denom != 4 and denom != 8)
+        fail (Error_Out_Of_Range(scale));
+    return denom;
+}
+
+
+//
+//  Make_Jpeg_Image: C
+//
+// Take over RGBA bytes that were rebAlloc()'d for an image of the given size.
+//
+static REBVAL *Make_Jpeg_Image(char *image_bytes, int w, int h)
+{
+    REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
+
+    REBVAL *image = rebValue(
+        "make image! compose [",
+            "(make pair! [", rebI(w), rebI(h), "])",
+            binary,
+        "]",
+    rebEND);
+
+    rebRelease(binary);
+    return image;
+}
 
 
 //
@@ -66,42 +121,235 @@ REBNATIVE(identify_jpeg_q)
 
 
 //
-//  decode-jpeg: native [
+//  export decode-jpeg: native [
 //
 //  {Codec for decoding BINARY! data for a JPEG}
 //
 //      return: [image!]
 //      data [binary!]
+//      /scale "Decode at 1/2, 1/4 or 1/8 size (much faster than resizing)"
+//          [integer!]
+//      /fast "Trade a little accuracy for speed (integer IDCT, no smoothing)"
 //  ]
 //
 REBNATIVE(decode_jpeg)
 {
     JPG_INCLUDE_PARAMS_OF_DECODE_JPEG;
 
+    int denom = Jpeg_Scale_Denom(ARG(scale));
+
+    jmp_buf jump;
+
     // Handle JPEG error throw:
-    if (setjmp(jpeg_state))
+    if (setjmp(jump))
         fail (Error_Bad_Media_Raw()); // generic
 
     REBYTE *data = VAL_BIN_AT(ARG(data));
     REBLEN len = VAL_LEN_AT(ARG(data));
 
     int w, h;
-    jpeg_info(s_cast(data), len, &w, &h); // may longjmp above
+    jpeg_info_scaled(s_cast(data), len, denom, &jump, &w, &h);  // may longjmp
 
     char *image_bytes = rebAllocN(char, (w * h) * 4);  // RGBA is 4 bytes
 
-    jpeg_load(s_cast(data), len, image_bytes);
+    jpeg_load_rgba(
+        s_cast(data), len, denom, REF(fast) ? 1 : 0, &jump, image_bytes
+    );
 
-    REBVAL *binary = rebRepossess(image_bytes, (w * h) * 4);
+    return Make_Jpeg_Image(image_bytes, w, h);
+}
 
-    REBVAL *image = rebValue(
-        "make image! compose [",
-            "(make pair! [", rebI(w), rebI(h), "])",
-            binary,
-        "]",
-    rebEND);
 
-    rebRelease(binary);
+// One image in a DECODE-JPEGS batch.  The main thread reads the headers and
+// allocates all the outputs up front, so the workers only run IJG code on
+// memory nobody else is touching...no API calls and no GC happen until they
+// are all finished.
+//
+struct Jpeg_Job {
+    char *data;  // points into a BINARY! of the block, which the frame holds
+    int len;
+    int w;
+    int h;
+    char *image_bytes;  // rebAlloc()'d, or NULL if the header was bad
+    bool ok;
+};
 
-    return image;
+struct Jpeg_Batch {
+    struct Jpeg_Job *jobs;
+    int num_jobs;
+    int next_job;  // index of next unclaimed job
+    int denom;
+    int fast;
+  #if defined(JPG_USE_PTHREADS)
+    pthread_mutex_t lock;
+  #endif
+};
+
+
+//
+//  Decode_Jpeg_Job: C
+//
+static void Decode_Jpeg_Job(struct Jpeg_Job *job, int denom, int fast)
+{
+    jmp_buf jump;
+    if (setjmp(jump)) {
+        job->ok = false;
+        return;
+    }
+
+    jpeg_load_rgba(job->data, job->len, denom, fast, &jump, job->image_bytes);
+    job->ok = true;
+}
+
+
+//
+//  Jpeg_Batch_Worker: C
+//
+// Claim jobs until there are none left.  Run by each thread, including the
+// main one, so images spread out evenly whatever their individual sizes.
+//
+static void *Jpeg_Batch_Worker(void *arg)
+{
+    struct Jpeg_Batch *batch = cast(struct Jpeg_Batch*, arg);
+
+    while (true) {
+      #if defined(JPG_USE_PTHREADS)
+        pthread_mutex_lock(&batch->lock);
+      #endif
+        int i = batch->next_job++;
+      #if defined(JPG_USE_PTHREADS)
+        pthread_mutex_unlock(&batch->lock);
+      #endif
+
+        if (i >= batch->num_jobs)
+            break;
+
+        struct Jpeg_Job *job = &batch->jobs[i];
+        if (job->image_bytes)
+            Decode_Jpeg_Job(job, batch->denom, batch->fast);
+    }
+    return nullptr;
+}
+
+
+//
+//  Jpeg_Info_Ok: C
+//
+static bool Jpeg_Info_Ok(struct Jpeg_Job *job, int denom)
+{
+    jmp_buf jump;
+    if (setjmp(jump))
+        return false;
+
+    jpeg_info_scaled(job->data, job->len, denom, &jump, &job->w, &job->h);
+    return true;
+}
+
+
+//
+//  export decode-jpegs: native [
+//
+//  {Decode many JPEGs at once, spreading the work across CPU cores}
+//
+//      return: "IMAGE! for each item, or BLANK! where the data was bad"
+//          [block!]
+//      data [block!]
+//          "BINARY! JPEG data"
+//      /scale "Decode at 1/2, 1/4 or 1/8 size (much faster than resizing)"
+//          [integer!]
+//      /fast "Trade a little accuracy for speed (integer IDCT, no smoothing)"
+//      /workers "Threads to use (default is one per CPU core)"
+//          [integer!]
+//  ]
+//
+REBNATIVE(decode_jpegs)
+{
+    JPG_INCLUDE_PARAMS_OF_DECODE_JPEGS;
+
+    struct Jpeg_Batch batch;
+    batch.denom = Jpeg_Scale_Denom(ARG(scale));
+    batch.fast = REF(fast) ? 1 : 0;
+    batch.next_job = 0;
+    batch.num_jobs = VAL_LEN_AT(ARG(data));
+    batch.jobs = rebAllocN(struct Jpeg_Job, batch.num_jobs + 1);  // +1: not 0
+
+    RELVAL *item = VAL_ARRAY_AT(ARG(data));
+    struct Jpeg_Job *job = batch.jobs;
+    for (; NOT_END(item); ++item, ++job) {
+        if (not IS_BINARY(item))
+            fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(ARG(data))));
+
+        job->data = s_cast(VAL_BIN_AT(item));
+        job->len = VAL_LEN_AT(item);
+        job->ok = false;
+        if (Jpeg_Info_Ok(job, batch.denom))
+            job->image_bytes = rebAllocN(char, (job->w * job->h) * 4);
+        else
+            job->image_bytes = nullptr;
+    }
+
+  #if defined(JPG_USE_PTHREADS)
+    REBINT num_workers;
+    if (REF(workers)) {
+        num_workers = VAL_INT32(ARG(workers));
+        if (num_workers < 1)
+            fail (Error_Out_Of_Range(ARG(workers)));
+    }
+    else {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_workers = cpus < 1 ? 1 : cast(REBINT, cpus);
+    }
+    if (num_workers > batch.num_jobs)
+        num_workers = batch.num_jobs;
+
+    pthread_mutex_init(&batch.lock, nullptr);
+
+    // The main thread is a worker too, so start one fewer thread.  If a
+    // thread can't be started, the ones that did (or just this one) will
+    // pick up its share of the jobs.
+    //
+    pthread_t *threads = rebAllocN(pthread_t, num_workers + 1);
+    REBINT num_started = 0;
+    for (; num_started < num_workers - 1; ++num_started) {
+        int err = pthread_create(
+            &threads[num_started], nullptr, &Jpeg_Batch_Worker, &batch
+        );
+        if (err != 0)
+            break;
+    }
+
+    Jpeg_Batch_Worker(&batch);
+
+    REBINT t;
+    for (t = 0; t < num_started; ++t)
+        pthread_join(threads[t], nullptr);
+
+    rebFree(threads);
+    pthread_mutex_destroy(&batch.lock);
+  #else
+    UNUSED(ARG(workers));
+
+    Jpeg_Batch_Worker(&batch);  // no threads on this platform (yet)
+  #endif
+
+    REBDSP dsp_orig = DSP;
+
+    REBINT i;
+    for (i = 0; i < batch.num_jobs; ++i) {
+        job = &batch.jobs[i];
+        if (not job->ok) {
+            if (job->image_bytes)
+                rebFree(job->image_bytes);
+            Init_Blank(DS_PUSH());
+            continue;
+        }
+
+        REBVAL *image = Make_Jpeg_Image(job->image_bytes, job->w, job->h);
+        Move_Value(DS_PUSH(), image);
+        rebRelease(image);
+    }
+
+    rebFree(batch.jobs);
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
 }
@@ -12,7 +12,13 @@
 
 extern jmp_buf jpeg_state;
 extern void jpeg_info(char *buffer, int nbytes, int *w, int *h);
-extern void jpeg_load(char *buffer, int nbytes, char *output);
+extern void jpeg_info_scaled(
+    char *buffer, int nbytes, int scale_denom, jmp_buf *jump, int *w, int *h
+);
+extern void jpeg_load_rgba(
+    char *buffer, int nbytes, int scale_denom, int fast, jmp_buf *jump,
+    char *output
+);
 
 
 #include "pstdint.h" // for uint32_t
@@ -108,16 +114,15 @@ METHODDEF(boolean)
 fill_input_buffer (j_decompress_ptr cinfo)
 {
   my_src_ptr src = (my_src_ptr) cinfo->src;
-  static JOCTET buffer[ 2 ];
+  /* Rebol: const, as decodes may be running on several threads */
+  static const JOCTET fake_eoi[ 2 ] = { (JOCTET) 0xFF, (JOCTET) JPEG_EOI };
 
   if (src->nbytes <= 0) {
     if (src->start_of_file) /* Treat empty input file as fatal error */
       ERREXIT(cinfo, JERR_INPUT_EMPTY);
     WARNMS(cinfo, JWRN_JPEG_EOF);
     /* Insert a fake EOI marker */
-    buffer[0] = (JOCTET) 0xFF;
-    buffer[1] = (JOCTET) JPEG_EOI;
-    src->pub.next_input_byte = buffer;
+    src->pub.next_input_byte = fake_eoi;
     src->pub.bytes_in_buffer = 2;
   }
   else {
@@ -222,12 +227,29 @@ jpeg_series_src (j_decompress_ptr cinfo, JOCTET *buffer, size_t nbytes )
 }
 
 void jpeg_info( char *buffer, int nbytes, int *w, int *h )
+{
+  jpeg_info_scaled(buffer, nbytes, 1, NULL, w, h);
+}
+
+/*
+ * Rebol: Errors longjmp() to the jmp_buf passed in as `jump` (stored in the
+ * client_data), or to the global jpeg_state if it is NULL.  Decodes that
+ * each have their own jmp_buf can run on different threads at once.
+ *
+ * A scale_denom of 2, 4 or 8 gives an image that size fraction of the
+ * original, with the IDCT only computing the pixels that are kept (much
+ * faster than decoding everything and then shrinking, e.g. for thumbnails).
+ */
+
+void jpeg_info_scaled( char *buffer, int nbytes, int scale_denom,
+                       jmp_buf *jump, int *w, int *h )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = (void *) jump;
   jpeg_create_decompress(&cinfo);
 
   /* Specify data source for decompression */
@@ -235,21 +257,36 @@ void jpeg_info( char *buffer, int nbytes, int *w, int *h )
 
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
-  *w = cinfo.image_width;
-  *h = cinfo.image_height;
+
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale_denom;
+  jpeg_calc_output_dimensions(&cinfo);
+  *w = cinfo.output_width;
+  *h = cinfo.output_height;
 
   jpeg_destroy_decompress(&cinfo);
 }
 
-void jpeg_load( char *buffer, int nbytes, char *output )
+/*
+ * Rebol: Decode to RGBA, 4 bytes per pixel.  `output` must have room for the
+ * width and height given by jpeg_info_scaled() with the same scale_denom.
+ *
+ * The color converter writes the RGBA itself (see JCS_EXT_RGBA), instead of
+ * writing RGB and then spreading it out to RGBA in a second pass.  If `fast`
+ * then the less accurate integer IDCT and plain upsampling are used.
+ */
+
+void jpeg_load_rgba( char *buffer, int nbytes, int scale_denom, int fast,
+                     jmp_buf *jump, char *output )
 {
   struct jpeg_decompress_struct cinfo;
   struct jpeg_error_mgr jerr;
   JSAMPROW  array[ 4 ];
-  unsigned int  i, j;
+  JDIMENSION stride, n, num_rows;
 
   /* Initialize the JPEG decompression object with default error handling. */
   cinfo.err = jpeg_std_error(&jerr);
+  cinfo.client_data = (void *) jump;
   jpeg_create_decompress(&cinfo);
 
   /* Specify data source for decompression */
@@ -258,53 +295,27 @@ void jpeg_load( char *buffer, int nbytes, char *output )
   /* Read file header, set default decompression parameters */
   (void) jpeg_read_header(&cinfo, TRUE);
 
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = scale_denom;
+  cinfo.out_color_space = JCS_EXT_RGBA;
+  if (fast) {
+    cinfo.dct_method = JDCT_IFAST;
+    cinfo.do_fancy_upsampling = FALSE;
+  }
+
   /* Start decompressor */
   (void) jpeg_start_decompress(&cinfo);
 
-  /* Process data */
+  /* Process data, straight into the rows of the output */
+  stride = cinfo.output_width * 4;
   while (cinfo.output_scanline < cinfo.output_height) {
-    array[ 0 ] = (JSAMPROW)(output + cinfo.output_scanline * cinfo.image_width * 4);
-    array[ 1 ] = array[ 0 ] + cinfo.image_width * 4;
-    array[ 2 ] = array[ 1 ] + cinfo.image_width * 4;
-    array[ 3 ] = array[ 2 ] + cinfo.image_width * 4;
-    jpeg_read_scanlines(&cinfo, array, 4 );
-  }
-
-  if (cinfo.out_color_space != JCS_GRAYSCALE)
-  // convert 3 byte values into four byte ones
-  for ( i=0; i<cinfo.image_height; i++ ) {
-    unsigned char   *cp;
-    unsigned char   *dp;
-
-    cp = (unsigned char *)(output + cinfo.image_width * 3);
-    dp = (unsigned char *)(output + cinfo.image_width * 4);
-    output = ( char * )dp;
-    for ( j=0; j<cinfo.image_width; j++ ) {
-        cp -= 3;
-        *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
-        *--dp = cp[2]; // blue
-        *--dp = cp[1]; // green
-        *--dp = cp[0]; // red
-    }
+    num_rows = cinfo.output_height - cinfo.output_scanline;
+    if (num_rows > 4)
+      num_rows = 4;
+    for (n = 0; n < num_rows; n++)
+      array[ n ] = (JSAMPROW)(output + (cinfo.output_scanline + n) * stride);
+    jpeg_read_scanlines(&cinfo, array, num_rows);
   }
-  else
-  // convert 1 byte value into four byte ones
-    for ( i=0; i<cinfo.image_height; i++ ) {
-      unsigned char *cp;
-      unsigned char *dp;
-      unsigned char c;
-
-      cp = (unsigned char *)(output + cinfo.image_width);
-      dp = (unsigned char *)(output + cinfo.image_width * 4);
-      output = ( char * )dp;
-      for ( j=0; j<cinfo.image_width; j++ ) {
-        c = *--cp;
-        *--dp = 0xff; // opaque alpha (going in reverse rgba order...)
-        *--dp = c; // blue
-        *--dp = c; // green
-        *--dp = c; // red
-      }
-    }
 
   /* Finish decompression and release memory.
    * I must do it in this order because output module has allocated memory
@@ -1170,6 +1181,7 @@ jpeg_calc_output_dimensions (j_decompress_ptr cinfo)
     break;
   case JCS_CMYK:
   case JCS_YCCK:
+  case JCS_EXT_RGBA:
     cinfo->out_color_components = 4;
     break;
   default:          /* else must be same colorspace as in file */
@@ -6741,6 +6753,112 @@ jpeg_idct_islow (j_decompress_ptr cinfo, jpeg_component_info * compptr,
 }
 
 #endif /* DCT_ISLOW_SUPPORTED */
+
+#ifdef IDCT_SCALING_SUPPORTED
+
+/*
+ * Rebol: Reduced-size inverse DCTs, standing in for IJG's jidctred.c.  They
+ * produce a 4x4, 2x2 or 1x1 block from an 8x8 block of coefficients, which
+ * is how jpeg_calc_output_dimensions() scales by 1/2, 1/4 and 1/8.  Only the
+ * lowest-frequency NxN coefficients matter, so besides the smaller output
+ * there is much less arithmetic than for a full IDCT.
+ *
+ * The tables hold C(u) * cos((2k+1) * u * pi / 2N) for output k (rows) and
+ * frequency u (columns), where C(0) = 1/sqrt(2) and C(u) = 1 otherwise.  The
+ * dequantization multipliers are the ISLOW ones, see start_pass().
+ */
+
+static const FAST_FLOAT jidctred_cos4[4 * 4] = {
+  0.707106781f,  0.923879533f,  0.707106781f,  0.382683432f,
+  0.707106781f,  0.382683432f, -0.707106781f, -0.923879533f,
+  0.707106781f, -0.382683432f, -0.707106781f,  0.923879533f,
+  0.707106781f, -0.923879533f,  0.707106781f, -0.382683432f
+};
+
+static const FAST_FLOAT jidctred_cos2[2 * 2] = {
+  0.707106781f,  0.707106781f,
+  0.707106781f, -0.707106781f
+};
+
+LOCAL(void)
+jidctred_NxN (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+          JCOEFPTR coef_block, JSAMPARRAY output_buf, JDIMENSION output_col,
+          int n, const FAST_FLOAT * table)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  FAST_FLOAT coef[4 * 4];  /* dequantized coefficients actually used */
+  FAST_FLOAT workspace[4 * 4];  /* buffers data between passes */
+  FAST_FLOAT sum;
+  JSAMPROW outptr;
+  int x, y, u, v;
+
+  for (v = 0; v < n; v++)
+    for (u = 0; u < n; u++)
+      coef[v * n + u] = (FAST_FLOAT)
+          (coef_block[v * DCTSIZE + u] * quantptr[v * DCTSIZE + u]);
+
+  /* Pass 1: process columns, workspace[y][u] = sum over v */
+  for (y = 0; y < n; y++) {
+    for (u = 0; u < n; u++) {
+      sum = 0;
+      for (v = 0; v < n; v++)
+        sum += table[y * n + v] * coef[v * n + u];
+      workspace[y * n + u] = sum;
+    }
+  }
+
+  /* Pass 2: process rows, scale by 1/4 as the 2-D 8x8 IDCT does, and */
+  /* round.  Offsetting before the cast makes it round to nearest even */
+  /* for negatives; the range limit table then wraps and clamps. */
+  for (y = 0; y < n; y++) {
+    outptr = output_buf[y] + output_col;
+    for (x = 0; x < n; x++) {
+      sum = 0;
+      for (u = 0; u < n; u++)
+        sum += table[x * n + u] * workspace[y * n + u];
+      outptr[x] = range_limit[
+        ((int) (sum * 0.25f + (RANGE_MASK + 1) + 0.5f) - (RANGE_MASK + 1))
+        & RANGE_MASK
+      ];
+    }
+  }
+}
+
+GLOBAL(void)
+jpeg_idct_4x4 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  jidctred_NxN(cinfo, compptr, coef_block, output_buf, output_col,
+               4, jidctred_cos4);
+}
+
+GLOBAL(void)
+jpeg_idct_2x2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  jidctred_NxN(cinfo, compptr, coef_block, output_buf, output_col,
+               2, jidctred_cos2);
+}
+
+GLOBAL(void)
+jpeg_idct_1x1 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+           JCOEFPTR coef_block,
+           JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  ISLOW_MULT_TYPE * quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table;
+  JSAMPLE *range_limit = IDCT_range_limit(cinfo);
+  INT32 dcval;
+  SHIFT_TEMPS
+
+  /* Only the DC term counts; the 8x8 IDCT would give it a scale of 1/8 */
+  dcval = (INT32) (coef_block[0] * quantptr[0]);
+  output_buf[0][output_col] = range_limit[(int) DESCALE(dcval, 3) & RANGE_MASK];
+}
+
+#endif /* IDCT_SCALING_SUPPORTED */
 /*
  * jdsample.c
  *
@@ -7455,6 +7573,98 @@ gray_rgb_convert (j_decompress_ptr cinfo,
 }
 
 
+/*
+ * Rebol: Conversions for JCS_EXT_RGBA, which write the opaque alpha byte as
+ * they go.  This way the rows can be decoded directly into an IMAGE!'s
+ * buffer, with no second pass spreading RGB triples out to 4 bytes.
+ */
+
+METHODDEF(void)
+ycc_rgba_convert (j_decompress_ptr cinfo,
+          JSAMPIMAGE input_buf, JDIMENSION input_row,
+          JSAMPARRAY output_buf, int num_rows)
+{
+  my_cconvert_ptr cconvert = (my_cconvert_ptr) cinfo->cconvert;
+  int y, cb, cr;
+  JSAMPROW outptr;
+  JSAMPROW inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  /* copy these pointers into registers if possible */
+  JSAMPLE * range_limit = cinfo->sample_range_limit;
+  int * Crrtab = cconvert->Cr_r_tab;
+  int * Cbbtab = cconvert->Cb_b_tab;
+  INT32 * Crgtab = cconvert->Cr_g_tab;
+  INT32 * Cbgtab = cconvert->Cb_g_tab;
+  SHIFT_TEMPS
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col < num_cols; col++) {
+      y  = GETJSAMPLE(inptr0[col]);
+      cb = GETJSAMPLE(inptr1[col]);
+      cr = GETJSAMPLE(inptr2[col]);
+      outptr[0] = range_limit[y + Crrtab[cr]];
+      outptr[1] = range_limit[y +
+                  ((int) RIGHT_SHIFT(Cbgtab[cb] + Crgtab[cr],
+                         SCALEBITS))];
+      outptr[2] = range_limit[y + Cbbtab[cb]];
+      outptr[3] = MAXJSAMPLE;
+      outptr += 4;
+    }
+  }
+}
+
+METHODDEF(void)
+gray_rgba_convert (j_decompress_ptr cinfo,
+          JSAMPIMAGE input_buf, JDIMENSION input_row,
+          JSAMPARRAY output_buf, int num_rows)
+{
+  JSAMPROW inptr, outptr;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+
+  while (--num_rows >= 0) {
+    inptr = input_buf[0][input_row++];
+    outptr = *output_buf++;
+    for (col = 0; col < num_cols; col++) {
+      outptr[0] = outptr[1] = outptr[2] = inptr[col];
+      outptr[3] = MAXJSAMPLE;
+      outptr += 4;
+    }
+  }
+}
+
+METHODDEF(void)
+rgb_rgba_convert (j_decompress_ptr cinfo,
+          JSAMPIMAGE input_buf, JDIMENSION input_row,
+          JSAMPARRAY output_buf, int num_rows)
+{
+  JSAMPROW inptr0, inptr1, inptr2, outptr;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col < num_cols; col++) {
+      outptr[0] = inptr0[col];
+      outptr[1] = inptr1[col];
+      outptr[2] = inptr2[col];
+      outptr[3] = MAXJSAMPLE;
+      outptr += 4;
+    }
+  }
+}
+
+
 /*
  * Adobe-style YCCK->CMYK conversion.
  * We convert YCbCr to R=1-C, G=1-M, and B=1-Y using the same
@@ -7589,6 +7799,19 @@ jinit_color_deconverter (j_decompress_ptr cinfo)
       ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
     break;
 
+  case JCS_EXT_RGBA:
+    cinfo->out_color_components = 4;
+    if (cinfo->jpeg_color_space == JCS_YCbCr) {
+      cconvert->pub.color_convert = ycc_rgba_convert;
+      build_ycc_rgb_table(cinfo);
+    } else if (cinfo->jpeg_color_space == JCS_GRAYSCALE) {
+      cconvert->pub.color_convert = gray_rgba_convert;
+    } else if (cinfo->jpeg_color_space == JCS_RGB) {
+      cconvert->pub.color_convert = rgb_rgba_convert;
+    } else
+      ERREXIT(cinfo, JERR_CONVERSION_NOTIMPL);
+    break;
+
   case JCS_CMYK:
     cinfo->out_color_components = 4;
     if (cinfo->jpeg_color_space == JCS_YCCK) {
@@ -7938,8 +8161,12 @@ jmp_buf jpeg_state;
 METHODDEF(void)
 error_exit (j_common_ptr cinfo)
 {
+    jmp_buf *jump = (jmp_buf *) cinfo->client_data;  /* Rebol: per decode */
+
     jpeg_destroy(cinfo); /* don't just abort, actually destroy the object */
 
+    if (jump != NULL)
+      longjmp(*jump, 1);
     longjmp(jpeg_state, 1);
 }
 
@@ -0,0 +1,7 @@
+REBOL []
+
+name: 'JSON
+source: %json/mod-json.c
+includes: [
+    %prep/extensions/json
+]
@@ -0,0 +1,834 @@
+//
+//  File: %mod-json.c
+//  Summary: "JSON codec"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/json/README.md
+//
+// Decoding is done in two stages, in the spirit of "simdjson":
+//
+// 1. Index_Json_Structurals() makes one pass over the bytes, recording the
+//    offset of every structural character (`{ } [ ] : ,`) and of every
+//    unescaped quote.  Runs of bytes that can't contain anything of interest
+//    are skipped 8 at a time, by testing a 64-bit word for the presence of
+//    certain bytes ("SWAR"--SIMD within a register).  This is portable C, so
+//    it works on any platform the interpreter builds for.
+//
+// 2. Decode_Json() walks that index.  Whatever lies in the gap between two
+//    marks is either whitespace or a scalar (number, true, false, null), so
+//    scalars are parsed knowing their extent up front.  Values are pushed to
+//    the data stack, and when a container closes its values are popped into
+//    a BLOCK! (arrays) or a MAP! (objects).
+//
+// Encoding writes directly into the mold buffer, so no intermediate strings
+// are made for nested values.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-json.h"
+
+
+#define JSON_MAX_DEPTH 1024
+
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_HIGHS 0x8080808080808080ULL
+
+// High bit set in each byte of x that is zero (exact, no false positives).
+//
+inline static REBU64 Swar_Zero_Bytes(REBU64 x) {
+    return ~(((x & ~SWAR_HIGHS) + ~SWAR_HIGHS) | x | ~SWAR_HIGHS);
+}
+
+inline static REBU64 Swar_Has_Byte(REBU64 x, REBYTE b) {
+    return Swar_Zero_Bytes(x ^ (SWAR_ONES * b));
+}
+
+// Inside a string, only a quote or backslash can change the scanner state.
+//
+inline static bool Swar_Has_String_Special(REBU64 x) {
+    return 0 != (Swar_Has_Byte(x, '"') | Swar_Has_Byte(x, '\\'));
+}
+
+// Outside a string: a quote or any structural.  `[` and `{` differ only by
+// the 0x20 bit, as do `]` and `}`, so OR-ing it in tests for both at once.
+//
+inline static bool Swar_Has_Structural(REBU64 x) {
+    REBU64 folded = x | (SWAR_ONES * 0x20);
+    return 0 != (
+        Swar_Has_Byte(x, '"')
+        | Swar_Has_Byte(x, ':')
+        | Swar_Has_Byte(x, ',')
+        | Swar_Has_Byte(folded, '{')
+        | Swar_Has_Byte(folded, '}')
+    );
+}
+
+inline static bool Is_Json_Space(REBYTE b) {
+    return b == ' ' or b == '\t' or b == '\n' or b == '\r';
+}
+
+
+typedef struct {
+    const REBYTE *json;
+    REBSIZ size;
+    const uint32_t *marks;  // offsets found by Index_Json_Structurals()
+    REBLEN num_marks;
+    REBLEN mark;  // next mark that has not been consumed
+    REBSIZ pos;  // first byte that has not been consumed
+} JSON_PARSER;
+
+
+ATTRIBUTE_NO_RETURN static void Fail_Json_At(
+    const JSON_PARSER *p,
+    REBSIZ offset
+){
+    UNUSED(p);
+
+    DECLARE_LOCAL (byte);
+    Init_Integer(byte, offset + 1);
+    rebJumps("fail [{Invalid JSON at byte}", byte, "]", rebEND);
+}
+
+
+//
+//  Index_Json_Structurals: C
+//
+// Stage 1 of decoding.  The index is an unmanaged series of uint32_t
+// offsets, which the caller must free.
+//
+static REBSER *Index_Json_Structurals(const REBYTE *json, REBSIZ size)
+{
+    if (size >= UINT32_MAX)
+        fail ("JSON input too large to index");
+
+    REBSER *index = Make_Series((size / 8) + 16, sizeof(uint32_t));
+    uint32_t *marks = SER_HEAD(uint32_t, index);
+    REBLEN rest = SER_REST(index);
+    REBLEN n = 0;
+
+    bool in_string = false;
+    REBSIZ i = 0;
+    while (i < size) {
+        REBSIZ limit = i + 8;
+        if (limit <= size) {
+            REBU64 word;
+            memcpy(&word, json + i, 8);  // unaligned-safe
+            if (
+                in_string
+                    ? not Swar_Has_String_Special(word)
+                    : not Swar_Has_Structural(word)
+            ){
+                i = limit;
+                continue;
+            }
+        }
+        else
+            limit = size;
+
+        // Something of interest is in this word, take it byte by byte.  An
+        // escape may step `i` one past `limit`, that's fine.
+        //
+        for (; i < limit; ++i) {
+            REBYTE b = json[i];
+            if (in_string) {
+                if (b == '\\')
+                    ++i;  // escaped byte can't end the string
+                else if (b == '"') {
+                    in_string = false;
+                    goto mark;
+                }
+                continue;
+            }
+
+            switch (b) {
+              case '"':
+                in_string = true;
+                goto mark;
+
+              case '{': case '}': case '[': case ']': case ':': case ',':
+                goto mark;
+
+              default:
+                continue;
+            }
+
+          mark:
+            if (n + 1 >= rest) {
+                SET_SERIES_LEN(index, n);
+                EXPAND_SERIES_TAIL(index, n);
+                marks = SER_HEAD(uint32_t, index);
+                rest = SER_REST(index);
+            }
+            marks[n++] = cast(uint32_t, i);
+        }
+    }
+
+    if (in_string)
+        fail ("Unterminated string in JSON input");
+
+    SET_SERIES_LEN(index, n);
+    return index;
+}
+
+
+// Position of the next mark, or the end of the input if there are no more.
+//
+inline static REBSIZ Next_Json_Mark(const JSON_PARSER *p) {
+    if (p->mark == p->num_marks)
+        return p->size;
+    return p->marks[p->mark];
+}
+
+
+// Is there only whitespace between what's been consumed and `at`?
+//
+static bool Is_Json_Gap_Space(const JSON_PARSER *p, REBSIZ at)
+{
+    REBSIZ i;
+    for (i = p->pos; i < at; ++i) {
+        if (not Is_Json_Space(p->json[i]))
+            return false;
+    }
+    return true;
+}
+
+
+// Consume the next mark, which must be the byte `expected` with nothing but
+// whitespace before it.
+//
+static void Take_Json_Mark(JSON_PARSER *p, REBYTE expected)
+{
+    REBSIZ at = Next_Json_Mark(p);
+    if (not Is_Json_Gap_Space(p, at))
+        Fail_Json_At(p, p->pos);
+    if (at == p->size or p->json[at] != expected)
+        Fail_Json_At(p, at);
+
+    ++p->mark;
+    p->pos = at + 1;
+}
+
+
+static REBUNI Scan_Json_Hex4(const JSON_PARSER *p, const REBYTE *cp)
+{
+    REBUNI c = 0;
+    REBLEN n;
+    for (n = 0; n < 4; ++n) {
+        REBYTE b = cp[n];
+        REBYTE nibble = 0;
+        if (b >= '0' and b <= '9')
+            nibble = b - '0';
+        else if ((b | 0x20) >= 'a' and (b | 0x20) <= 'f')
+            nibble = (b | 0x20) - 'a' + 10;
+        else
+            Fail_Json_At(p, (cp + n) - p->json);
+        c = (c << 4) | nibble;
+    }
+    return c;
+}
+
+
+//
+//  Scan_Json_String: C
+//
+// The string's opening quote is at `open` and its closing quote at `close`
+// (both already found by stage 1).  Strings without escapes--by far the
+// most common case--are made directly from the input bytes.
+//
+static REBSTR *Scan_Json_String(
+    const JSON_PARSER *p,
+    REBSIZ open,
+    REBSIZ close
+){
+    const REBYTE *start = p->json + open + 1;
+    const REBYTE *end = p->json + close;
+
+    const REBYTE *cp = start;
+    for (; cp != end; ++cp) {
+        if (*cp == '\\')
+            break;
+        if (*cp < 0x20)
+            Fail_Json_At(p, cp - p->json);
+    }
+    if (cp == end)
+        return Make_Sized_String_UTF8(cs_cast(start), end - start);
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    const REBYTE *segment = start;
+    for (; cp != end; ++cp) {
+        if (*cp < 0x20)
+            Fail_Json_At(p, cp - p->json);
+        if (*cp != '\\')
+            continue;
+
+        if (cp != segment)
+            Append_Utf8(mo->series, cs_cast(segment), cp - segment);
+
+        ++cp;  // stage 1 guarantees a byte follows, the close quote can't
+        REBUNI c;
+        switch (*cp) {
+          case '"': c = '"'; break;
+          case '\\': c = '\\'; break;
+          case '/': c = '/'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'n': c = '\n'; break;
+          case 'r': c = '\r'; break;
+          case 't': c = '\t'; break;
+
+          case 'u':
+            if (end - cp < 5)
+                Fail_Json_At(p, cp - p->json);
+            c = Scan_Json_Hex4(p, cp + 1);
+            cp += 4;
+
+            if (c >= 0xDC00 and c <= 0xDFFF)  // lone low surrogate
+                Fail_Json_At(p, cp - p->json);
+
+            if (c >= 0xD800 and c <= 0xDBFF) {  // must pair with a low one
+                if (end - cp < 7 or cp[1] != '\\' or cp[2] != 'u')
+                    Fail_Json_At(p, cp - p->json);
+                REBUNI low = Scan_Json_Hex4(p, cp + 3);
+                if (low < 0xDC00 or low > 0xDFFF)
+                    Fail_Json_At(p, cp - p->json);
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                cp += 6;
+            }
+
+            if (c == 0)
+                fail (Error_Illegal_Zero_Byte_Raw());
+            break;
+
+          default:
+            Fail_Json_At(p, cp - p->json);
+        }
+        Append_Codepoint(mo->series, c);
+        segment = cp + 1;
+    }
+
+    if (cp != segment)
+        Append_Utf8(mo->series, cs_cast(segment), cp - segment);
+
+    return Pop_Molded_String(mo);
+}
+
+
+//
+//  Scan_Json_Scalar: C
+//
+// Stage 1 marks bound the extent of a scalar, so the whole of [start, end)
+// must be consumed by exactly one number or literal.  Integers which fit in
+// 64 bits become INTEGER!, anything with a fraction or exponent (or which
+// is too big) becomes DECIMAL!.
+//
+static void Scan_Json_Scalar(
+    RELVAL *out,
+    const JSON_PARSER *p,
+    REBSIZ start,
+    REBSIZ end
+){
+    const REBYTE *cp = p->json + start;
+    REBSIZ len = end - start;
+
+    switch (*cp) {
+      case 't':
+        if (len == 4 and memcmp(cp, "true", 4) == 0) {
+            Init_Logic(out, true);
+            return;
+        }
+        Fail_Json_At(p, start);
+
+      case 'f':
+        if (len == 5 and memcmp(cp, "false", 5) == 0) {
+            Init_Logic(out, false);
+            return;
+        }
+        Fail_Json_At(p, start);
+
+      case 'n':
+        if (len == 4 and memcmp(cp, "null", 4) == 0) {
+            Init_Blank(out);
+            return;
+        }
+        Fail_Json_At(p, start);
+
+      default:
+        break;
+    }
+
+    // Validate against JSON's number grammar, which is much stricter than
+    // Rebol's (no leading `+`, no leading zeros, digits around the `.`)
+    //
+    const REBYTE *ep = p->json + end;
+    const REBYTE *s = cp;
+    bool negative = false;
+    if (*s == '-') {
+        negative = true;
+        ++s;
+    }
+
+    if (s == ep or *s < '0' or *s > '9')
+        Fail_Json_At(p, s - p->json);
+
+    bool integral = true;
+    REBU64 magnitude = 0;
+    bool overflow = false;
+    if (*s == '0')
+        ++s;
+    else {
+        for (; s != ep and *s >= '0' and *s <= '9'; ++s) {
+            REBU64 digit = *s - '0';
+            if (magnitude > (cast(REBU64, INT64_MAX) - digit) / 10)
+                overflow = true;
+            else
+                magnitude = magnitude * 10 + digit;
+        }
+    }
+
+    if (s != ep and *s == '.') {
+        integral = false;
+        ++s;
+        if (s == ep or *s < '0' or *s > '9')
+            Fail_Json_At(p, s - p->json);
+        while (s != ep and *s >= '0' and *s <= '9')
+            ++s;
+    }
+
+    if (s != ep and (*s == 'e' or *s == 'E')) {
+        integral = false;
+        ++s;
+        if (s != ep and (*s == '+' or *s == '-'))
+            ++s;
+        if (s == ep or *s < '0' or *s > '9')
+            Fail_Json_At(p, s - p->json);
+        while (s != ep and *s >= '0' and *s <= '9')
+            ++s;
+    }
+
+    if (s != ep)
+        Fail_Json_At(p, s - p->json);
+
+    if (integral and not overflow) {
+        REBI64 i = cast(REBI64, magnitude);
+        Init_Integer(out, negative ? -i : i);
+        return;
+    }
+
+    if (len > MAX_NUM_LEN)
+        fail ("JSON number has too many digits");
+
+    // Scan_Decimal() looks at the byte after the number (and would take a
+    // following `,` as a decimal point), so give it a terminated copy.
+    //
+    REBYTE buf[MAX_NUM_LEN + 1];
+    memcpy(buf, cp, len);
+    buf[len] = '\0';
+    if (not Scan_Decimal(out, buf, len, true))
+        Fail_Json_At(p, start);
+}
+
+
+//
+//  Decode_Json: C
+//
+// Stage 2 of decoding.
+//
+static void Decode_Json(RELVAL *out, const REBYTE *json, REBSIZ size)
+{
+    REBSER *index = Index_Json_Structurals(json, size);
+
+    JSON_PARSER parser;
+    JSON_PARSER *p = &parser;
+    p->json = json;
+    p->size = size;
+    p->marks = SER_HEAD(uint32_t, index);
+    p->num_marks = SER_USED(index);
+    p->mark = 0;
+    p->pos = 0;
+
+    REBDSP dsp_orig = DSP;
+
+    REBDSP bases[JSON_MAX_DEPTH];  // stack position where container began
+    REBYTE opens[JSON_MAX_DEPTH];  // `[` or `{`
+    REBLEN depth = 0;
+
+  parse_value: {
+    REBSIZ at = Next_Json_Mark(p);
+
+    REBSIZ start = p->pos;
+    while (start < at and Is_Json_Space(json[start]))
+        ++start;
+
+    if (start != at) {  // something before the next mark, must be a scalar
+        REBSIZ end = at;
+        while (Is_Json_Space(json[end - 1]))
+            --end;
+        Scan_Json_Scalar(DS_PUSH(), p, start, end);
+        p->pos = at;
+        goto after_value;
+    }
+
+    if (at == size)
+        Fail_Json_At(p, at);
+
+    REBYTE b = json[at];
+    if (b == '"') {
+        REBSTR *s = Scan_Json_String(p, at, p->marks[p->mark + 1]);
+        Init_Text(DS_PUSH(), s);
+        p->pos = p->marks[p->mark + 1] + 1;
+        p->mark += 2;
+        goto after_value;
+    }
+
+    if (b != '[' and b != '{')
+        Fail_Json_At(p, at);
+
+    if (depth == JSON_MAX_DEPTH)
+        fail ("JSON input is nested too deeply");
+
+    ++p->mark;
+    p->pos = at + 1;
+    bases[depth] = DSP;
+    opens[depth] = b;
+    ++depth;
+
+    REBSIZ next = Next_Json_Mark(p);
+    if (
+        next != size
+        and json[next] == b + 2  // `]` is `[` + 2, and `}` is `{` + 2
+        and Is_Json_Gap_Space(p, next)
+    ){
+        Take_Json_Mark(p, b + 2);
+        goto close_container;
+    }
+
+    if (b == '{')
+        goto parse_key;
+    goto parse_value;
+  }
+
+  parse_key: {
+    REBSIZ open = Next_Json_Mark(p);
+    Take_Json_Mark(p, '"');
+    REBSIZ close = p->marks[p->mark];
+    REBSTR *key = Scan_Json_String(p, open, close);
+    Init_Text(DS_PUSH(), key);
+    ++p->mark;
+    p->pos = close + 1;
+
+    Take_Json_Mark(p, ':');
+    goto parse_value;
+  }
+
+  after_value: {
+    if (depth == 0) {
+        if (p->mark != p->num_marks or not Is_Json_Gap_Space(p, size))
+            Fail_Json_At(p, p->pos);
+        goto finished;
+    }
+
+    REBSIZ at = Next_Json_Mark(p);
+    if (at != size and json[at] == ',') {
+        Take_Json_Mark(p, ',');
+        if (opens[depth - 1] == '{')
+            goto parse_key;
+        goto parse_value;
+    }
+
+    Take_Json_Mark(p, opens[depth - 1] + 2);
+    goto close_container;
+  }
+
+  close_container: {
+    --depth;
+    if (opens[depth] == '[') {
+        REBARR *a = Pop_Stack_Values(bases[depth]);
+        Init_Block(DS_PUSH(), a);
+        goto after_value;
+    }
+
+    // Later duplicates of a key overwrite earlier ones.  Keys are compared
+    // case-sensitively, as JSON keys are.
+    //
+    REBMAP *map = Make_Map((DSP - bases[depth]) / 2);
+    REBDSP dsp;
+    for (dsp = bases[depth] + 1; dsp < DSP; dsp += 2) {
+        const bool cased = true;
+        Find_Map_Entry(
+            map, DS_AT(dsp), SPECIFIED, DS_AT(dsp + 1), SPECIFIED, cased
+        );
+    }
+    DS_DROP_TO(bases[depth]);
+    Init_Map(DS_PUSH(), map);
+    goto after_value;
+  }
+
+  finished:
+    assert(DSP == dsp_orig + 1);
+    Move_Value(out, DS_TOP);
+    DS_DROP_TO(dsp_orig);
+
+    Free_Unmanaged_Series(index);
+}
+
+
+//
+//  identify-json?: native [
+//
+//  {Codec for identifying BINARY! data for a JSON object or array}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_json_q)
+{
+    JSON_INCLUDE_PARAMS_OF_IDENTIFY_JSON_Q;
+
+    const REBYTE *cp = VAL_BIN_AT(ARG(data));
+    REBLEN len = VAL_LEN_AT(ARG(data));
+
+    // Only a leading `{` or `[` is checked (a full validation will happen
+    // on decode).  Bare scalars are valid JSON too, but too easily confused
+    // with other data to be worth claiming.
+    //
+    if (len >= 3 and cp[0] == 0xEF and cp[1] == 0xBB and cp[2] == 0xBF) {
+        cp += 3;
+        len -= 3;
+    }
+    for (; len != 0 and Is_Json_Space(*cp); ++cp, --len)
+        NOOP;
+
+    return Init_Logic(D_OUT, len != 0 and (*cp == '{' or *cp == '['));
+}
+
+
+//
+//  decode-json: native [
+//
+//  {Codec for decoding JSON (objects become MAP!, arrays become BLOCK!)}
+//
+//      return: [map! block! text! integer! decimal! logic! blank!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(decode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_DECODE_JSON;
+
+    const REBYTE *json = VAL_BIN_AT(ARG(data));
+    REBSIZ size = VAL_LEN_AT(ARG(data));
+
+    if (size >= 3 and json[0] == 0xEF and json[1] == 0xBB and json[2] == 0xBF) {
+        json += 3;  // RFC 8259 lets parsers ignore a byte order mark
+        size -= 3;
+    }
+
+    Decode_Json(D_OUT, json, size);
+    return D_OUT;
+}
+
+
+static void Encode_Json_String(REB_MOLD *mo, const REBYTE *utf8, REBSIZ size)
+{
+    REBSTR *buf = mo->series;
+    Append_Codepoint(buf, '"');
+
+    const REBYTE *end = utf8 + size;
+    const REBYTE *segment = utf8;
+    const REBYTE *cp = utf8;
+    for (; cp != end; ++cp) {
+        REBYTE b = *cp;
+        if (b >= 0x20 and b != '"' and b != '\\')
+            continue;
+
+        if (cp != segment)
+            Append_Utf8(buf, cs_cast(segment), cp - segment);
+
+        switch (b) {
+          case '"': Append_Ascii(buf, "\\\""); break;
+          case '\\': Append_Ascii(buf, "\\\\"); break;
+          case '\b': Append_Ascii(buf, "\\b"); break;
+          case '\f': Append_Ascii(buf, "\\f"); break;
+          case '\n': Append_Ascii(buf, "\\n"); break;
+          case '\r': Append_Ascii(buf, "\\r"); break;
+          case '\t': Append_Ascii(buf, "\\t"); break;
+
+          default: {
+            char hex[7];
+            sprintf(hex, "\\u%04X", cast(unsigned int, b));
+            Append_Ascii_Len(buf, hex, 6);
+            break; }
+        }
+        segment = cp + 1;
+    }
+
+    if (cp != segment)
+        Append_Utf8(buf, cs_cast(segment), cp - segment);
+
+    Append_Codepoint(buf, '"');
+}
+
+
+static void Encode_Json_Key(REB_MOLD *mo, const RELVAL *key)
+{
+    if (not ANY_STRING(key) and not ANY_WORD(key))
+        fail (Error_Bad_Value_Core(key, SPECIFIED));
+
+    REBSIZ size;
+    const REBYTE *utf8 = VAL_UTF8_AT(&size, key);
+    Encode_Json_String(mo, utf8, size);
+    Append_Codepoint(mo->series, ':');
+}
+
+
+//
+//  Encode_Json_Value: C
+//
+// Cycles are not tracked (as MOLD does with TG_Mold_Stack), the depth limit
+// stops them instead.
+//
+static void Encode_Json_Value(
+    REB_MOLD *mo,
+    const RELVAL *v,
+    REBSPC *specifier,
+    REBLEN depth
+){
+    if (depth > JSON_MAX_DEPTH)
+        fail ("Value is nested too deeply (or cyclic) to encode as JSON");
+
+    REBSTR *buf = mo->series;
+
+    switch (VAL_TYPE(v)) {
+      case REB_BLANK:
+        Append_Ascii(buf, "null");
+        return;
+
+      case REB_LOGIC:
+        Append_Ascii(buf, VAL_LOGIC(v) ? "true" : "false");
+        return;
+
+      case REB_INTEGER: {
+        REBYTE num[60];
+        REBINT len = Emit_Integer(num, VAL_INT64(v));
+        Append_Ascii_Len(buf, s_cast(num), len);
+        return; }
+
+      case REB_DECIMAL: {
+        REBDEC d = VAL_DECIMAL(v);
+        if (d - d != 0.0)  // true for both infinities and NaN
+            fail ("JSON can't represent infinite or NaN decimals");
+
+        REBYTE num[60];
+        REBINT len = Emit_Decimal(num, d, 0, '.', 17);
+        Append_Ascii_Len(buf, s_cast(num), len);
+        return; }
+
+      case REB_BLOCK: {
+        REBSPC *derived = Derive_Specifier(specifier, v);
+        Append_Codepoint(buf, '[');
+        RELVAL *item = VAL_ARRAY_AT(v);
+        for (; NOT_END(item); ++item) {
+            if (item != VAL_ARRAY_AT(v))
+                Append_Codepoint(buf, ',');
+            Encode_Json_Value(mo, item, derived, depth + 1);
+        }
+        Append_Codepoint(buf, ']');
+        return; }
+
+      case REB_MAP: {
+        bool first = true;
+        Append_Codepoint(buf, '{');
+        RELVAL *key = ARR_HEAD(MAP_PAIRLIST(VAL_MAP(v)));
+        for (; NOT_END(key); key += 2) {
+            if (IS_NULLED(key + 1))
+                continue;  // removed entry
+            if (not first)
+                Append_Codepoint(buf, ',');
+            first = false;
+            Encode_Json_Key(mo, key);
+            Encode_Json_Value(mo, key + 1, SPECIFIED, depth + 1);
+        }
+        Append_Codepoint(buf, '}');
+        return; }
+
+      case REB_OBJECT: {
+        bool first = true;
+        Append_Codepoint(buf, '{');
+        REBCTX *c = VAL_CONTEXT(v);
+        REBVAL *key = CTX_KEYS_HEAD(c);
+        REBVAL *var = CTX_VARS_HEAD(c);
+        for (; NOT_END(key); ++key, ++var) {
+            if (Is_Param_Hidden(key))
+                continue;
+            if (not first)
+                Append_Codepoint(buf, ',');
+            first = false;
+
+            Encode_Json_String(
+                mo,
+                STR_HEAD(VAL_KEY_SPELLING(key)),
+                STR_SIZE(VAL_KEY_SPELLING(key))
+            );
+            Append_Codepoint(buf, ':');
+            if (IS_NULLED(var))
+                Append_Ascii(buf, "null");
+            else
+                Encode_Json_Value(mo, var, SPECIFIED, depth + 1);
+        }
+        Append_Codepoint(buf, '}');
+        return; }
+
+      default:
+        if (ANY_STRING(v) or ANY_WORD(v)) {
+            REBSIZ size;
+            const REBYTE *utf8 = VAL_UTF8_AT(&size, v);
+            Encode_Json_String(mo, utf8, size);
+            return;
+        }
+        fail (Error_Bad_Value_Core(v, specifier));
+    }
+}
+
+
+//
+//  encode-json: native [
+//
+//  {Codec for encoding a value as JSON (UTF-8, without extra whitespace)}
+//
+//      return: [binary!]
+//      value [map! object! block! any-string! any-word! integer! decimal!
+//          logic! blank!]
+//  ]
+//
+REBNATIVE(encode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_ENCODE_JSON;
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    Encode_Json_Value(mo, ARG(value), SPECIFIED, 0);
+
+    return Init_Binary(D_OUT, Pop_Molded_Binary(mo));
+}
@@ -39,6 +39,16 @@
 
 #include "reb-net.h"
 
+#if !defined(TO_WINDOWS)
+    #include <signal.h>
+    #include <sys/types.h>
+    #include <sys/uio.h>  // struct iovec, for sendmsg()
+    #if defined(__linux__)
+        #include <time.h>  // timespec, for sigtimedwait()
+        #include <sys/sendfile.h>
+    #endif
+#endif
+
 #if 0
     #define WATCH1(s,a) printf(s, a)
     #define WATCH2(s,a,b) printf(s, a, b)
@@ -90,6 +100,232 @@ static void Get_Local_IP(REBREQ *sock)
     ReqNet(sock)->local_port = ntohs(sa.sin_port);
 }
 
+#define NET_SEND_MAX (1 << 30)  // keep what one call sends in an `int`
+#define NET_IOV_MAX 64  // pieces per sendmsg() (or WSASend()) call
+
+
+//
+//  Send_Pieces: C
+//
+// Send a BLOCK! of BINARY! and TEXT! (see RSM_PIECES) from where req->actual
+// says to, with sendmsg() (or WSASend() on Windows) so the pieces needn't be
+// JOINed into one BINARY! first.  Keeps going, NET_IOV_MAX pieces at a time,
+// until all are sent or the socket won't take more without blocking.
+//
+// Returns bytes sent, or -1 with the error in GET_ERROR if none could be.
+//
+static int Send_Pieces(REBREQ *sock)
+{
+    struct rebol_devreq *req = Req(sock);
+
+    RELVAL *head = VAL_ARRAY_AT(req->common.binary);
+    REBLEN num_pieces = VAL_LEN_AT(req->common.binary);
+
+    REBLEN i = 0;  // first piece not completely sent
+    size_t skip = req->actual;  // bytes of it that were sent
+    for (; i < num_pieces; ++i) {
+        REBSIZ size;
+        VAL_BYTES_AT(&size, head + i);
+        if (skip < size)
+            break;
+        skip -= size;
+    }
+
+    int sent = 0;
+    while (i < num_pieces and sent < NET_SEND_MAX) {
+      #ifdef TO_WINDOWS
+        WSABUF bufs[NET_IOV_MAX];
+      #else
+        struct iovec bufs[NET_IOV_MAX];
+      #endif
+        int count = 0;
+        size_t batch = 0;
+
+        REBLEN n;
+        for (n = i; n < num_pieces and count < NET_IOV_MAX; ++n) {
+            REBSIZ size;
+            const REBYTE *bytes = VAL_BYTES_AT(&size, head + n);
+            if (n == i) {
+                bytes += skip;
+                size -= skip;
+            }
+            if (size == 0)
+                continue;
+          #ifdef TO_WINDOWS
+            bufs[count].buf = m_cast(char*, s_cast(bytes));
+            bufs[count].len = size;
+          #else
+            bufs[count].iov_base = m_cast(REBYTE*, bytes);
+            bufs[count].iov_len = size;
+          #endif
+            ++count;
+            batch += size;
+        }
+        if (count == 0)
+            break;  // only empty pieces left
+
+      #ifdef TO_WINDOWS
+        DWORD bytes;
+        if (WSASend(req->requestee.socket, bufs, count, &bytes, 0, 0, 0) != 0)
+            return sent > 0 ? sent : -1;
+      #else
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = bufs;
+        msg.msg_iovlen = count;
+
+        ssize_t bytes = sendmsg(req->requestee.socket, &msg, MSG_NOSIGNAL);
+        if (bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            return sent > 0 ? sent : -1;  // error will come up next time
+        }
+      #endif
+        WATCH2("sendmsg() len: %d actual: %d\n", cast(int, batch), bytes);
+
+        sent += bytes;
+        if (cast(size_t, bytes) < batch)
+            break;  // the socket won't take more now
+
+        i = n;
+        skip = 0;
+    }
+
+    return sent;
+}
+
+
+//
+//  Keep_Unsent_Pieces: C
+//
+// Pieces are only sent where they are while WRITE is running.  Whatever the
+// socket doesn't take then is copied into a BINARY! to be sent like that of
+// any other WRITE, so the caller is free to change the pieces afterward.
+//
+static void Keep_Unsent_Pieces(REBREQ *sock)
+{
+    struct rebol_devreq *req = Req(sock);
+    REBVAL *pieces = req->common.binary;
+
+    REBBIN *bin = Make_Binary(req->length - req->actual);
+    REBLEN used = 0;
+
+    size_t skip = req->actual;
+    RELVAL *item = VAL_ARRAY_AT(pieces);
+    for (; NOT_END(item); ++item) {
+        REBSIZ size;
+        const REBYTE *bytes = VAL_BYTES_AT(&size, item);
+        if (skip >= size) {
+            skip -= size;
+            continue;
+        }
+        memcpy(BIN_AT(bin, used), bytes + skip, size - skip);
+        used += size - skip;
+        skip = 0;
+    }
+    TERM_BIN_LEN(bin, used);
+    assert(used == req->length - req->actual);
+
+    rebRelease(pieces);
+    req->common.binary = Init_Binary(Alloc_Value(), bin);
+    rebUnmanage(req->common.binary);
+
+    req->length = used;
+    req->actual = 0;
+    req->state &= ~RSM_PIECES;
+}
+
+
+#if !defined(TO_WINDOWS)
+
+#define NET_FILE_CHUNK (64 * 1024)  // for sending files without sendfile()
+
+//
+//  Send_File_Chunk: C
+//
+// Send as much of the rest of a file (opened by WRITE of a FILE!) as the
+// socket will take without blocking.  The file's data goes straight from the
+// page cache to the socket with Linux's sendfile(), else a chunk at a time
+// through a buffer on the stack.  The position in the file is req->actual,
+// so if send() only takes part of a chunk, the rest is read again next time.
+//
+// Returns bytes sent, or -1 with errno set.
+//
+static int Send_File_Chunk(REBREQ *sock, size_t len)
+{
+    struct rebol_devreq *req = Req(sock);
+    int fd = ReqNet(sock)->file_fd;
+    off_t offset = req->actual;
+
+  #if defined(__linux__)
+    if (len > NET_SEND_MAX)
+        len = NET_SEND_MAX;
+
+    // sendfile() takes no flags to pass MSG_NOSIGNAL, and Linux has no
+    // SO_NOSIGPIPE.  So SIGPIPE is blocked around it, and one raised by a
+    // closed connection is taken off the pending signals before they are
+    // unblocked.  The SIGPIPE is sent to this thread, so it's this thread's
+    // mask that's changed (sigprocmask() is unspecified once there are other
+    // threads, e.g. the file workers).
+    //
+    sigset_t pipe_set;
+    sigset_t old_set;
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_set, &old_set);
+
+    ssize_t sent = sendfile(req->requestee.socket, fd, &offset, len);
+    int errnum = errno;
+
+    if (sent < 0 and errnum == EPIPE and not sigismember(&old_set, SIGPIPE)) {
+        struct timespec no_wait = {0, 0};
+        sigtimedwait(&pipe_set, nullptr, &no_wait);
+    }
+    pthread_sigmask(SIG_SETMASK, &old_set, nullptr);
+
+    if (sent > 0)
+        return cast(int, sent);
+
+    if (sent == 0) {  // file got shorter since WRITE found its size
+        errno = EIO;
+        return -1;
+    }
+
+    errno = errnum;
+    if (errno != EINVAL and errno != ENOSYS)
+        return -1;
+
+    // EINVAL is what sendfile() says for files it can't mmap(), e.g. on some
+    // FUSE filesystems.  Fall through to copying.
+  #endif
+
+    char buffer[NET_FILE_CHUNK];
+    if (len > NET_FILE_CHUNK)
+        len = NET_FILE_CHUNK;
+
+    ssize_t bytes = pread(fd, buffer, len, offset);
+    if (bytes <= 0) {
+        if (bytes == 0)  // file got shorter since WRITE found its size
+            errno = EIO;
+        return -1;
+    }
+
+    return send(req->requestee.socket, buffer, bytes, MSG_NOSIGNAL);
+}
+
+
+//
+//  Finish_Send_File: C
+//
+static void Finish_Send_File(REBREQ *sock)
+{
+    close(ReqNet(sock)->file_fd);
+    Req(sock)->state &= ~RSM_FILE;
+}
+
+#endif
+
+
 static bool Try_Set_Sock_Options(SOCKET sock)
 {
   #if defined(SO_NOSIGPIPE)
@@ -245,6 +481,11 @@ DEVICE_CMD Close_Socket(REBREQ *sock)
 
     if (req->state & RSM_OPEN) {
 
+      #if !defined(TO_WINDOWS)
+        if (req->state & RSM_FILE)  // closed while sending a file
+            Finish_Send_File(sock);
+      #endif
+
         req->state = 0;  // clear: RSM_OPEN, RSM_CONNECT
 
         // If DNS pending, abort it:
@@ -448,19 +689,30 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     if (mode == RSM_SEND) {
         size_t len = req->length - req->actual;  // how much to try to write
 
-        // If host is no longer connected:
-        Set_Addr(
-            &remote_addr,
-            ReqNet(sock)->remote_ip,
-            ReqNet(sock)->remote_port
-        );
-        result = sendto(
-            req->requestee.socket,
-            s_cast(VAL_BIN_AT_HEAD(req->common.binary, req->actual)), len,
-            MSG_NOSIGNAL, // Flags
-            cast(struct sockaddr*, &remote_addr), addr_len
-        );
-        WATCH2("send() len: %d actual: %d\n", cast(int, len), result);
+      #if !defined(TO_WINDOWS)
+        if (req->state & RSM_FILE) {  // WRITE of a FILE! (TCP only)
+            result = Send_File_Chunk(sock, len);
+            WATCH2("sendfile() len: %d actual: %d\n", cast(int, len), result);
+        }
+        else
+      #endif
+        if (req->state & RSM_PIECES)  // WRITE of a BLOCK! (TCP only)
+            result = Send_Pieces(sock);
+        else {
+            // If host is no longer connected:
+            Set_Addr(
+                &remote_addr,
+                ReqNet(sock)->remote_ip,
+                ReqNet(sock)->remote_port
+            );
+            result = sendto(
+                req->requestee.socket,
+                s_cast(VAL_BIN_AT_HEAD(req->common.binary, req->actual)), len,
+                MSG_NOSIGNAL, // Flags
+                cast(struct sockaddr*, &remote_addr), addr_len
+            );
+            WATCH2("send() len: %d actual: %d\n", cast(int, len), result);
+        }
 
         if (result < 0)
             goto error_unless_wouldblock;  // may release and trash binary
@@ -469,8 +721,16 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
 
         assert(req->actual <= req->length);
         if (req->actual == req->length) {
-            rebRelease(req->common.binary);
-            TRASH_POINTER_IF_DEBUG(req->common.binary);
+          #if !defined(TO_WINDOWS)
+            if (req->state & RSM_FILE)
+                Finish_Send_File(sock);
+            else
+          #endif
+            {
+                rebRelease(req->common.binary);
+                TRASH_POINTER_IF_DEBUG(req->common.binary);
+                req->state &= ~RSM_PIECES;
+            }
 
             rebElide(
                 "insert system/ports/system make event! [",
@@ -482,6 +742,9 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
             return DR_DONE;
         }
 
+        if (req->state & RSM_PIECES)
+            Keep_Unsent_Pieces(sock);
+
         req->flags |= RRF_ACTIVE; // notify OS_WAIT of activity
         return DR_PEND;  // still more to go
     }
@@ -580,8 +843,11 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
 
     result = GET_ERROR;
 
-    if (result == NE_WOULDBLOCK)
+    if (result == NE_WOULDBLOCK) {
+        if (req->state & RSM_PIECES)
+            Keep_Unsent_Pieces(sock);
         return DR_PEND;  // don't consider blocking to be an actual "error"
+    }
 
     REBVAL *error = rebError_OS(result);
 
@@ -603,8 +869,16 @@ DEVICE_CMD Transfer_Socket(REBREQ *sock)
     // can be overridden.
 
     if (mode == RSM_SEND) {
-        rebRelease(req->common.binary);
-        TRASH_POINTER_IF_DEBUG(req->common.binary);
+      #if !defined(TO_WINDOWS)
+        if (req->state & RSM_FILE)
+            Finish_Send_File(sock);
+        else
+      #endif
+        {
+            rebRelease(req->common.binary);
+            TRASH_POINTER_IF_DEBUG(req->common.binary);
+            req->state &= ~RSM_PIECES;
+        }
     }
 
     // We are killing the request that has the network error (it cannot be
@@ -24,6 +24,10 @@
 
 #include "sys-net.h"
 
+#if !defined(TO_WINDOWS)
+    #include <sys/stat.h>
+#endif
+
 #undef IS_ERROR
 
 #include "sys-core.h"
@@ -75,6 +79,66 @@ static void Query_Net(REBVAL *out, REBVAL *port, struct devreq_net *sock)
 }
 
 
+#if !defined(TO_WINDOWS)
+
+//
+//  Start_Send_File: C
+//
+// Set up a TCP socket request for WRITE of a FILE!, which Transfer_Socket()
+// sends straight from the file (see Send_File_Chunk()).  So the file is never
+// read into a BINARY!, however big it is.  Returns false if there's nothing
+// to send (an empty file, or a /PART of 0).
+//
+static bool Start_Send_File(
+    REBREQ *sock,
+    const REBVAL *file,
+    const REBVAL *part  // NULL if no /PART
+){
+    Check_Security_Placeholder(Canon(SYM_FILE), SYM_READ, file);
+
+    if (part and (not IS_INTEGER(part) or VAL_INT64(part) < 0))
+        fail (part);
+
+    char *path_utf8 = rebSpell("file-to-local/full", file, rebEND);
+    int fd = open(path_utf8, O_RDONLY);
+    rebFree(path_utf8);
+
+    if (fd < 0)
+        rebFail_OS (errno);
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        int errnum = errno;
+        close(fd);
+        rebFail_OS (errnum);
+    }
+    if (not S_ISREG(info.st_mode)) {  // only regular files have a size
+        close(fd);
+        rebFail_OS (S_ISDIR(info.st_mode) ? EISDIR : EINVAL);
+    }
+
+    REBI64 length = info.st_size;
+    if (part and VAL_INT64(part) < length)
+        length = VAL_INT64(part);
+
+    if (length == 0) {
+        close(fd);
+        return false;
+    }
+
+    struct rebol_devreq *req = Req(sock);
+    TRASH_POINTER_IF_DEBUG(req->common.data);
+    TRASH_POINTER_IF_DEBUG(req->common.binary);
+    ReqNet(sock)->file_fd = fd;
+    req->state |= RSM_FILE;
+    req->length = length;
+    req->actual = 0;
+    return true;
+}
+
+#endif
+
+
 //
 //  Transport_Actor: C
 //
@@ -397,29 +461,98 @@ static REB_R Transport_Actor(
         //
         REBVAL *data = ARG(data);
 
-        // Setup the write.  We copy the data into the request, so that you
-        // can say things like:
-        //
-        //     data: {abc}
-        //     write port data
-        //     reverse data
-        //     write port data
-        //
-        // We also want to make sure the /PART is handled correctly, so by
-        // delegating to COPY/PART we get that for free.
+      #if !defined(TO_WINDOWS)
+        if (req->state & RSM_FILE)  // the request is still sending from it
+            fail ("Port is still sending a FILE! (WAIT for its WROTE event)");
+      #endif
+
+        // A FILE! sends the file's contents.  Over TCP this doesn't read it
+        // into memory, but sends it from the file as the socket takes it.
         //
-        TRASH_POINTER_IF_DEBUG(req->common.data);
-        req->common.binary = rebValue(
-            "as binary! copy/part", data, rebQ1(REF(part)),
-        rebEND);
+        bool from_file = false;
+        if (IS_FILE(data)) {
+          #if !defined(TO_WINDOWS)
+            if (not (req->modes & RST_UDP)) {
+                from_file = Start_Send_File(sock, data, REF(part));
+                if (not from_file)
+                    Init_Binary(data, Make_Binary(0));  // nothing to send
+            }
+            else
+          #endif
+            {
+                REBVAL *bin = rebValue("read", data, rebEND);
+                Move_Value(data, bin);
+                rebRelease(bin);
+            }
+        }
 
-        // Because requests can be handled asynchronously, we won't
-        // necessarily free the handle before WRITE ends.  Unmanage it.
+        // A BLOCK! of BINARY! and TEXT! is sent without JOINing the pieces
+        // into one BINARY! first (see Send_Pieces()).  UDP JOINs them, as
+        // they must go in one datagram anyway.
         //
-        rebUnmanage(req->common.binary);
+        bool from_pieces = false;
+        if (IS_BLOCK(data)) {
+            if (REF(part))
+                fail (Error_Bad_Refines_Raw());
+
+            REBSIZ total = 0;
+            RELVAL *item = VAL_ARRAY_AT(data);
+            for (; NOT_END(item); ++item) {
+                if (not IS_BINARY(item) and not IS_TEXT(item))
+                    fail (Error_Bad_Value_Core(item, VAL_SPECIFIER(data)));
+
+                REBSIZ size;
+                VAL_BYTES_AT(&size, item);
+                total += size;
+            }
 
-        req->length = VAL_LEN_AT(req->common.binary);
-        req->actual = 0;
+            if (total != 0 and not (req->modes & RST_UDP)) {
+                TRASH_POINTER_IF_DEBUG(req->common.data);
+                req->common.binary = rebValue("copy", data, rebEND);
+                rebUnmanage(req->common.binary);
+                req->state |= RSM_PIECES;
+                req->length = total;
+                req->actual = 0;
+                from_pieces = true;
+            }
+            else {  // one datagram (or nothing to send)
+                REBBIN *bin = Make_Binary(total);
+                for (item = VAL_ARRAY_AT(data); NOT_END(item); ++item) {
+                    REBSIZ size;
+                    const REBYTE *bytes = VAL_BYTES_AT(&size, item);
+                    memcpy(BIN_TAIL(bin), bytes, size);
+                    TERM_BIN_LEN(bin, BIN_LEN(bin) + size);
+                }
+                Init_Binary(data, bin);
+            }
+        }
+
+        if (not from_file and not from_pieces) {
+            //
+            // Setup the write.  We copy the data into the request, so that
+            // you can say things like:
+            //
+            //     data: {abc}
+            //     write port data
+            //     reverse data
+            //     write port data
+            //
+            // We also want to make sure the /PART is handled correctly, so by
+            // delegating to COPY/PART we get that for free.
+            //
+            TRASH_POINTER_IF_DEBUG(req->common.data);
+            req->common.binary = rebValue(
+                "as binary! copy/part", data, rebQ1(REF(part)),
+            rebEND);
+
+            // Because requests can be handled asynchronously, we won't
+            // necessarily free the handle before WRITE ends.  Unmanage it.
+            //
+            rebUnmanage(req->common.binary);
+
+            req->length = VAL_LEN_AT(req->common.binary);
+            req->actual = 0;
+        }
 
         REBVAL *result = OS_DO_DEVICE(sock, RDC_WRITE);
 
@@ -39,7 +39,9 @@ enum {
     RSM_LISTEN  = 1 << 4,   // socket is listening (TCP)
     RSM_SEND    = 1 << 5,   // sending
     RSM_RECEIVE = 1 << 6,   // receiving
-    RSM_ACCEPT  = 1 << 7    // an inbound connection
+    RSM_ACCEPT  = 1 << 7,   // an inbound connection
+    RSM_FILE    = 1 << 8,   // sending from file_fd (WRITE of a FILE!)
+    RSM_PIECES  = 1 << 9    // sending a BLOCK! of BINARY!/TEXT! pieces
 };
 
 #define IPA(a,b,c,d) (a<<24 | b<<16 | c<<8 | d)
@@ -51,6 +53,7 @@ struct devreq_net {
     uint32_t remote_ip;     // remote address
     uint32_t remote_port;   // remote port
     void *host_info;        // for DNS usage
+    int file_fd;            // file being sent, if RSM_FILE
 };
 
 inline static struct devreq_net *ReqNet(REBREQ *req) {
@@ -80,6 +80,16 @@ void lodepng_free(void* ptr)
 //
 //=////////////////////////////////////////////////////////////////////////=//
 
+// The `custom_context` passed through to the hooks.  Knowing the exact size
+// of the inflated scanlines lets the decompression write straight into one
+// buffer, instead of guessing a size and growing it.  The compression level
+// lets ENCODE-PNG/FAST and ENCODE-PNG/LEVEL trade size for speed.
+//
+struct Png_Zlib_Context {
+    size_t expected_size;  // 0 if unknown (e.g. interlaced images)
+    int level;  // -1 for zlib's default
+};
+
 static unsigned rebol_zlib_decompress(
     unsigned char **out,
     size_t *outsize,
@@ -87,23 +97,27 @@ static unsigned rebol_zlib_decompress(
     size_t insize,
     const LodePNGDecompressSettings *settings
 ){
-    // as far as I can tell, the logic of LodePNG is to preallocate a buffer
-    // and so out and outsize are already set up.  This is due to some
-    // knowledge it has about the scanlines.  But it's passed in as "out"
-    // pointer parameters in case you update it (?)
-    //
-    // Rebol's decompression was not written for the caller to provide
-    // a buffer, though COMPRESS/INTO or DECOMPRESS/INTO would be useful.
-    // So consider it.  But for now, free the buffer and let the logic of
-    // zlib always make its own.
+    // LodePNG preallocates the scanline buffer from its prediction of the
+    // size, but doesn't pass along what that size is.  So free it, and make
+    // a new one either of the size we worked out in DECODE-PNG or let the
+    // core guess (LodePNG checks the result against its prediction).
     //
     rebFree(*out);
 
-    assert(5 == *cast(const int*, settings->custom_context)); // just testing
-    UNUSED(settings->custom_context);
+    const struct Png_Zlib_Context *ctx = cast(
+        const struct Png_Zlib_Context*, settings->custom_context
+    );
 
     // PNG uses "zlib envelope" w/ADLER32 checksum, hence "Zinflate"
     //
+    if (ctx->expected_size != 0) {
+        *out = rebAllocN(unsigned char, ctx->expected_size);
+        *outsize = Decompress_Into_Core(
+            *out, ctx->expected_size, in, insize, Canon(SYM_ZLIB)
+        );
+        return 0;
+    }
+
     const REBINT max = -1; // size unknown, inflation will need to guess
     size_t out_len;
     *out = cast(unsigned char*, rebZinflateAlloc(&out_len, in, insize, max));
@@ -119,14 +133,17 @@ static unsigned rebol_zlib_compress(
     size_t insize,
     const LodePNGCompressSettings *settings
 ){
-    lodepng_free(*out); // see remarks in decompress, and about COMPRESS/INTO
+    lodepng_free(*out); // see remarks in decompress
 
-    assert(5 == *cast(const int*, settings->custom_context)); // just testing
-    UNUSED(settings->custom_context);
+    const struct Png_Zlib_Context *ctx = cast(
+        const struct Png_Zlib_Context*, settings->custom_context
+    );
 
     // PNG uses "zlib envelope" w/ADLER32 checksum, hence "Zdeflate"
     //
-    *out = cast(unsigned char*, rebZdeflateAlloc(outsize, in, insize));
+    *out = Compress_Alloc_Core(
+        outsize, in, insize, Canon(SYM_ZLIB), ctx->level
+    );
 
     return 0;
 }
@@ -150,13 +167,11 @@ REBNATIVE(identify_png_q)
 
     // use the zlib already built into Rebol for DECOMPRESS, inflate()
     //
+    struct Png_Zlib_Context ctx;
+    ctx.expected_size = 0;
+    ctx.level = -1;
     state.decoder.zlibsettings.custom_zlib = rebol_zlib_decompress;
-
-    // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put decompression settings or state in there)
-    //
-    int arg = 5;
-    state.decoder.zlibsettings.custom_context = &arg;
+    state.decoder.zlibsettings.custom_context = &ctx;
 
     unsigned width;
     unsigned height;
@@ -186,50 +201,119 @@ REBNATIVE(identify_png_q)
 
 
 //
-//  decode-png: native [
+//  export decode-png: native [
 //
 //  {Codec for decoding BINARY! data for a PNG}
 //
 //      return: [image!]
 //      data [binary!]
+//      /into "Decode into this image's pixels instead of making a new image"
+//          [image!]
 //  ]
 //
 REBNATIVE(decode_png)
 {
     PNG_INCLUDE_PARAMS_OF_DECODE_PNG;
 
+    const REBYTE *data = VAL_BIN_AT(ARG(data));
+    REBLEN size = VAL_LEN_AT(ARG(data));
+
     LodePNGState state;
     lodepng_state_init(&state);
 
     // use the zlib already built into Rebol for DECOMPRESS, inflate()
     //
+    struct Png_Zlib_Context ctx;
+    ctx.expected_size = 0;
+    ctx.level = -1;
     state.decoder.zlibsettings.custom_zlib = rebol_zlib_decompress;
+    state.decoder.zlibsettings.custom_context = &ctx;
 
-    // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put decompression settings or state in there)
+    // Text chunks are thrown away (see below), and skipping them means any
+    // zTXt chunks won't be inflated with the scanlines' expected size.
     //
-    int arg = 5;
-    state.decoder.zlibsettings.custom_context = &arg;
+    state.decoder.read_text_chunks = 0;
+
+    // A non-interlaced image is its rows one after another, each starting
+    // with a byte saying which filter it used.  (LodePNG re-reads the header
+    // in lodepng_decode(), and reports any error in it from there.)
+    //
+    unsigned w;
+    unsigned h;
+    if (
+        lodepng_inspect(&w, &h, &state, data, size) == 0
+        and state.info_png.interlace_method == 0
+    ){
+        size_t row_bytes = (
+            cast(size_t, w) * lodepng_get_bpp(&state.info_png.color) + 7
+        ) / 8;
+        ctx.expected_size = h * (row_bytes + 1);
+    }
 
     // Even if the input PNG doesn't have alpha or color, ask for conversion
-    // to RGBA.
+    // to RGBA.  But when decoding /INTO an image, get the PNG's own format
+    // and convert it directly into the image's pixels.
     //
-    state.decoder.color_convert = 1;
-    state.info_png.color.colortype = LCT_RGBA;
-    state.info_png.color.bitdepth = 8;
+    state.decoder.color_convert = REF(into) ? 0 : 1;
+    state.info_raw.colortype = LCT_RGBA;
+    state.info_raw.bitdepth = 8;
 
     unsigned char* image_bytes;
-    unsigned w;
-    unsigned h;
     unsigned error = lodepng_decode(
         &image_bytes,
         &w,
         &h,
         &state,
-        VAL_BIN_AT(ARG(data)), // PNG data
-        VAL_LEN_AT(ARG(data)) // PNG data length
+        data, // PNG data
+        size // PNG data length
     );
 
+    if (error != 0) {
+        lodepng_state_cleanup(&state);
+        fail (lodepng_error_text(error));
+    }
+
+    if (REF(into)) {
+        REBVAL *into = ARG(into);
+
+        REBVAL *pair = rebValue("pick", into, "'size", rebEND);
+        REBLEN into_w = rebUnboxInteger("pick", pair, "'x", rebEND);
+        REBLEN into_h = rebUnboxInteger("pick", pair, "'y", rebEND);
+        rebRelease(pair);
+
+        if (into_w != w or into_h != h) {
+            lodepng_state_cleanup(&state);
+            rebFree(image_bytes);
+            fail ("DECODE-PNG/INTO image must be the same size as the PNG");
+        }
+
+        // BYTES OF an IMAGE! is the image's own binary, not a copy
+        //
+        REBVAL *binary = rebValue("bytes of", into, rebEND);
+        FAIL_IF_READ_ONLY(binary);
+        REBYTE *pixels = VAL_BIN_HEAD(binary);
+
+        const LodePNGColorMode *png_mode = &state.info_png.color;
+        if (png_mode->colortype == LCT_RGBA and png_mode->bitdepth == 8)
+            memcpy(pixels, image_bytes, (w * h) * 4);
+        else {
+            LodePNGColorMode rgba;
+            lodepng_color_mode_init(&rgba);  // 8-bit RGBA
+            error = lodepng_convert(
+                pixels, image_bytes, &rgba, png_mode, w, h
+            );
+        }
+
+        rebRelease(binary);
+        lodepng_state_cleanup(&state);
+        rebFree(image_bytes);
+
+        if (error != 0)
+            fail (lodepng_error_text(error));
+
+        RETURN (into);
+    }
+
     // `state` can contain potentially interesting information, such as
     // metadata (key="Software" value="REBOL", for instance).  Currently this
     // is just thrown away, but it might be interesting to have access to.
@@ -238,11 +322,9 @@ REBNATIVE(decode_png)
     //
     lodepng_state_cleanup(&state);
 
-    if (error != 0)
-        fail (lodepng_error_text(error));
-
-    // Note LodePNG cannot decode into an existing buffer, though it has been
-    // requested:
+    // Note LodePNG cannot unfilter into an existing buffer, though it has
+    // been requested.  But when the PNG is already 8-bit RGBA, the buffer it
+    // returns becomes the image's binary without copying.
     //
     // https://github.com/lvandeve/lodepng/issues/17
     //
@@ -263,12 +345,17 @@ REBNATIVE(decode_png)
 
 
 //
-//  encode-png: native [
+//  export encode-png: native [
 //
 //  {Codec for encoding a PNG image}
 //
 //      return: [binary!]
 //      image [image!]
+//      /level "Deflate level, 0 (store only) to 9 (smallest), default is 6"
+//          [integer!]
+//      /filter "Row filter choice: NONE, MINSUM (default), ENTROPY, BRUTE"
+//          [word!]
+//      /fast "Filter NONE at level 1, e.g. for intermediate files"
 // ]
 //
 REBNATIVE(encode_png)
@@ -286,13 +373,37 @@ REBNATIVE(encode_png)
 
     // use the zlib already built into Rebol for DECOMPRESS, deflate()
     //
+    struct Png_Zlib_Context ctx;
+    ctx.expected_size = 0;
+    ctx.level = REF(fast) ? 1 : -1;
+    if (REF(level)) {
+        ctx.level = VAL_INT32(ARG(level));
+        if (ctx.level < 0 or ctx.level > 9)
+            fail (PAR(level));
+    }
     state.encoder.zlibsettings.custom_zlib = rebol_zlib_compress;
+    state.encoder.zlibsettings.custom_context = &ctx;
 
-    // this is how to pass an arbitrary void* that custom zlib can access
-    // (so one could put dompression settings or state in there)
+    // LodePNG's default is to try all five PNG filters on every row and keep
+    // whichever has the smallest sum (MINSUM), which often costs more time
+    // than the deflate.  Filter NONE does no work at all.
     //
-    int arg = 5;
-    state.encoder.zlibsettings.custom_context = &arg;
+    if (REF(filter)) {
+        REBVAL *filter = ARG(filter);
+        if (rebDidQ("'none =", filter, rebEND))
+            state.encoder.filter_strategy = LFS_ZERO;
+        else if (rebDidQ("'minsum =", filter, rebEND))
+            state.encoder.filter_strategy = LFS_MINSUM;
+        else if (rebDidQ("'entropy =", filter, rebEND))
+            state.encoder.filter_strategy = LFS_ENTROPY;
+        else if (rebDidQ("'brute =", filter, rebEND))
+            state.encoder.filter_strategy = LFS_BRUTE_FORCE;
+        else
+            fail (PAR(filter));
+    }
+    else if (REF(fast))
+        state.encoder.filter_strategy = LFS_ZERO;
+    state.encoder.filter_palette_zero = 0;  // always use the chosen strategy
 
     // input format
     //
@@ -315,8 +426,12 @@ REBNATIVE(encode_png)
     REBLEN height = rebUnboxInteger("pick", size, "'y", rebEND);
     rebRelease(size);
 
-    size_t binsize;
-    REBYTE *image_bytes = rebBytes(&binsize, "bytes of", image, rebEND);
+    // BYTES OF an IMAGE! is the image's own binary, so this encodes from the
+    // pixels in place instead of copying them out first.  Nothing can run
+    // that would modify the image until the encode is finished.
+    //
+    REBVAL *binary = rebValue("bytes of", image, rebEND);
+    const REBYTE *image_bytes = VAL_BIN_HEAD(binary);
 
     size_t encoded_size;
     REBYTE *encoded_bytes = NULL;
@@ -330,7 +445,7 @@ REBNATIVE(encode_png)
     );
     lodepng_state_cleanup(&state);
 
-    rebFree(image_bytes);
+    rebRelease(binary);
 
     if (error != 0)
         fail (lodepng_error_text(error));
@@ -57,6 +57,7 @@
     #include <fcntl.h>
     #include <poll.h>
     #include <signal.h>
+    #include <sys/mman.h>
     #include <sys/stat.h>
     #include <sys/wait.h>
     #if !defined(WIFCONTINUED) && defined(TO_ANDROID)
@@ -844,4 +845,285 @@ REBNATIVE(send_signal)
     return Init_Void(D_OUT);
 }
 
+
+// Each forked worker gets a fixed-size slot in one shared anonymous mapping.
+// Pages are only committed when touched, so a generous default /LIMIT does
+// not cost memory for workers that return little.  The parent reads the
+// slot after the worker has exited, so no locking is needed.
+//
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+    #define MAP_ANONYMOUS MAP_ANON
+#endif
+#if !defined(MAP_NORESERVE)
+    #define MAP_NORESERVE 0
+#endif
+
+#define FORK_SLOT_PENDING 0  // worker died before writing (e.g. crashed)
+#define FORK_SLOT_DONE 1  // data is the BINARY! the action returned
+#define FORK_SLOT_FAILED 2  // data is the UTF-8 FORM of the error
+#define FORK_SLOT_OVERFLOW 3  // result didn't fit, size is what was needed
+
+struct Fork_Slot_Header {
+    int64_t size;
+    int32_t status;
+};
+
+#define FORK_SLOT_DATA_OFFSET \
+    ((sizeof(struct Fork_Slot_Header) + 15) & ~cast(size_t, 15))
+
+#define FORK_DEFAULT_LIMIT (64 * 1024 * 1024)
+
+struct Fork_Job {
+    const REBVAL *action;
+    const REBVAL *job;
+};
+
+
+//
+//  Run_Fork_Job_Dangerous: C
+//
+// Called under rebRescue() in the child, so a failure in the action can be
+// passed back to the parent instead of unwinding into the parent's stack
+// (which the child has a copy of, but must never return into).
+//
+static REBVAL *Run_Fork_Job_Dangerous(void *opaque)
+{
+    struct Fork_Job *j = cast(struct Fork_Job*, opaque);
+    return rebValue(
+        "ensure binary!", j->action, rebQ(j->job, rebEND),
+    rebEND);
+}
+
+
+//
+//  Write_Fork_Slot: C
+//
+static void Write_Fork_Slot(
+    REBYTE *slot,
+    REBLEN limit,
+    int32_t status,
+    const REBYTE *data,
+    REBSIZ size
+){
+    struct Fork_Slot_Header *h = cast(struct Fork_Slot_Header*, slot);
+    h->size = size;
+    if (size > limit) {
+        h->status = FORK_SLOT_OVERFLOW;
+        return;
+    }
+    memcpy(slot + FORK_SLOT_DATA_OFFSET, data, size);
+    h->status = status;
+}
+
+
+//
+//  fork-workers: native [
+//
+//  {Run an action on each job in its own forked process, results in order}
+//
+//      return: "One BINARY! per job, as returned by the action"
+//          [block!]
+//      jobs "Values to pass to the action, one worker process per value"
+//          [block!]
+//      action "Must return a BINARY! (e.g. an ENCODE of the result)"
+//          [action!]
+//      /limit "Maximum result size per worker in bytes (default 64MB)"
+//          [integer!]
+//  ]
+//  platforms: [linux android posix osx]
+//
+REBNATIVE(fork_workers)
+//
+// Workers are copy-on-write forks of the interpreter, so they see all the
+// parent's data and functions without it being serialized.  Only results
+// come back, through a MAP_SHARED segment instead of pipes--so there is no
+// need to multiplex reads to keep workers from blocking on full pipes.
+{
+    PROCESS_INCLUDE_PARAMS_OF_FORK_WORKERS;
+
+    REBLEN num_jobs = VAL_LEN_AT(ARG(jobs));
+    if (num_jobs == 0)
+        return Init_Block(D_OUT, Make_Array(0));
+
+    REBI64 limit = REF(limit) ? VAL_INT64(ARG(limit)) : FORK_DEFAULT_LIMIT;
+    if (limit < 0 or limit > INT32_MAX)
+        fail (PAR(limit));
+
+    size_t slot_size = FORK_SLOT_DATA_OFFSET + ((limit + 15) & ~15);
+    size_t total = slot_size * num_jobs;
+
+    void *mem = mmap(
+        nullptr,
+        total,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1,
+        0
+    );
+    if (mem == MAP_FAILED)
+        rebFail_OS (errno);
+
+    REBYTE *base = cast(REBYTE*, mem);  // zero-filled, so status PENDING
+
+    // Anything the parent has buffered for stdout would be flushed by each
+    // child too, if it weren't emptied before forking.
+    //
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t *pids = rebAllocN(pid_t, num_jobs);
+
+    REBLEN n;
+    for (n = 0; n < num_jobs; ++n) {
+        REBYTE *slot = base + slot_size * n;
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            int errno_save = errno;
+            REBLEN k;
+            for (k = 0; k < n; ++k) {  // don't leave zombies behind
+                kill(pids[k], SIGKILL);
+
+                // The exit status can only be the SIGKILL just sent, and it
+                // is the fork() error that gets reported.
+                //
+                int status;
+                while (waitpid(pids[k], &status, 0) < 0) {
+                    if (errno != EINTR)
+                        break;
+                }
+            }
+            rebFree(pids);
+            munmap(mem, total);
+            rebFail_OS (errno_save);
+        }
+
+        if (pid == 0) {
+
+    //=//// CHILD BRANCH OF FORK() ////////////////////////////////////////=//
+
+            DECLARE_LOCAL (job);
+            Derelativize(
+                job, VAL_ARRAY_AT(ARG(jobs)) + n, VAL_SPECIFIER(ARG(jobs))
+            );
+
+            struct Fork_Job j;
+            j.action = ARG(action);
+            j.job = job;
+
+            REBVAL *result = rebRescue(&Run_Fork_Job_Dangerous, &j);
+
+            if (result and IS_ERROR(result)) {
+                size_t size;
+                unsigned char *utf8 = rebBytes(
+                    &size, "form", result,
+                rebEND);
+                Write_Fork_Slot(
+                    slot, limit, FORK_SLOT_FAILED, utf8, size
+                );
+            }
+            else {
+                Write_Fork_Slot(
+                    slot,
+                    limit,
+                    FORK_SLOT_DONE,
+                    VAL_BIN_AT(result),
+                    VAL_LEN_AT(result)
+                );
+            }
+
+            // _exit() and not exit(), because atexit() handlers and stdio
+            // buffers belong to the parent's copy of the process.
+            //
+            _exit(0);
+        }
+
+        pids[n] = pid;
+    }
+
+    //=//// PARENT: REAP WORKERS, THEN GATHER RESULTS IN ORDER ////////////=//
+
+    // A worker that wrote its slot but then didn't exit cleanly (e.g. the
+    // action called an OS exit() with an error code, or it was killed) is a
+    // failure too.  If the status can't be had (e.g. SIGCHLD is ignored, so
+    // the child was reaped already) the slot is all there is to go by.
+    //
+    int *statuses = rebAllocN(int, num_jobs);
+    for (n = 0; n < num_jobs; ++n) {
+        statuses[n] = 0;
+        while (waitpid(pids[n], &statuses[n], 0) < 0) {
+            if (errno != EINTR) {
+                statuses[n] = 0;
+                break;
+            }
+        }
+    }
+    rebFree(pids);
+
+    REBDSP dsp_orig = DSP;
+
+    for (n = 0; n < num_jobs; ++n) {
+        REBYTE *slot = base + slot_size * n;
+        struct Fork_Slot_Header *h = cast(struct Fork_Slot_Header*, slot);
+
+        int status = statuses[n];
+        bool exited_ok = WIFEXITED(status) and WEXITSTATUS(status) == 0;
+
+        if (h->status == FORK_SLOT_DONE and exited_ok) {
+            REBSER *bin = Make_Binary(h->size);
+            memcpy(BIN_HEAD(bin), slot + FORK_SLOT_DATA_OFFSET, h->size);
+            TERM_BIN_LEN(bin, h->size);
+            Init_Binary(DS_PUSH(), bin);
+            continue;
+        }
+
+        DS_DROP_TO(dsp_orig);
+
+        REBVAL *message;
+        if (h->status == FORK_SLOT_FAILED)
+            message = rebSizedText(
+                cs_cast(slot + FORK_SLOT_DATA_OFFSET), h->size
+            );
+        else if (h->status == FORK_SLOT_OVERFLOW)
+            message = rebValue(
+                "spaced [{result of}", rebI(h->size),
+                    "{bytes exceeds /LIMIT of}", rebI(limit), "]",
+            rebEND);
+        else if (WIFSIGNALED(status))
+            message = rebValue(
+                "spaced [{process killed by signal}",
+                    rebI(WTERMSIG(status)),
+                "]",
+            rebEND);
+        else if (not exited_ok)
+            message = rebValue(
+                "spaced [{process exited with status}",
+                    rebI(WEXITSTATUS(status)),
+                "]",
+            rebEND);
+        else
+            message = rebText("process exited without a result");
+
+        rebFree(statuses);
+        munmap(mem, total);
+
+        DECLARE_LOCAL (job);
+        Derelativize(
+            job, VAL_ARRAY_AT(ARG(jobs)) + n, VAL_SPECIFIER(ARG(jobs))
+        );
+
+        rebJumps(
+            "fail [{FORK-WORKERS job}", rebI(n + 1),
+                "mold/limit", rebQ(job, rebEND), "60",
+                "{failed:}", rebR(message),
+            "]",
+        rebEND);
+    }
+
+    rebFree(statuses);
+    munmap(mem, total);
+
+    return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
+}
+
 #endif // defined(TO_LINUX) || defined(TO_ANDROID) || defined(TO_POSIX) || defined(TO_OSX)
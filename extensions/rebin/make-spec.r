@@ -0,0 +1,7 @@
+REBOL []
+
+name: 'Rebin
+source: %rebin/mod-rebin.c
+includes: [
+    %prep/extensions/rebin
+]
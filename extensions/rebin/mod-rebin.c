@@ -0,0 +1,748 @@
+//
+//  File: %mod-rebin.c
+//  Summary: "Compact binary serialization of data values"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2020 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/rebin/README.md for the format.
+//
+// MOLD and LOAD round-trip data through source text, which means running the
+// scanner and re-parsing every number on the way back in.  This format is
+// for when the data only needs to be read by Rebol again (caches, IPC): each
+// value is a tag byte and a payload that can be copied or decoded directly.
+//
+// Arrays, maps and objects give their payload size in bytes up front, so a
+// reader can step over them without decoding.  DECODE-REBIN/AT uses that to
+// decode just one nested value out of a big file.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-rebin.h"
+
+
+#define REBIN_VERSION 1
+#define REBIN_MAX_DEPTH 1024
+
+enum Reb_Rebin_Tag {
+    REBIN_NULL = 0,  // only legal as the variable of an object
+    REBIN_BLANK,
+    REBIN_FALSE,
+    REBIN_TRUE,
+    REBIN_INTEGER,  // zigzag varint
+    REBIN_DECIMAL,  // 8 bytes, little endian IEEE-754
+    REBIN_PERCENT,  // 8 bytes, little endian IEEE-754
+    REBIN_CHAR,  // varint codepoint
+
+    REBIN_TEXT,  // varint size, then UTF-8 bytes
+    REBIN_FILE,
+    REBIN_EMAIL,
+    REBIN_URL,
+    REBIN_TAG,
+    REBIN_ISSUE,
+
+    REBIN_BINARY,  // varint size, then bytes
+
+    REBIN_WORD,  // varint symbol number
+    REBIN_SET_WORD,
+    REBIN_GET_WORD,
+    REBIN_SYM_WORD,
+
+    REBIN_BLOCK,  // varint count, 4-byte payload size, then values
+    REBIN_GROUP,
+    REBIN_MAP,  // varint pair count, 4-byte payload size, then key/values
+    REBIN_OBJECT,  // varint count, 4-byte payload size, then symbol/values
+
+    REBIN_MAX
+};
+
+#define REBIN_TAG_MASK 0x3F
+#define REBIN_FLAG_NEWLINE_BEFORE 0x80
+#define REBIN_FLAG_NEWLINE_AT_TAIL 0x40  // only on arrays
+
+
+//=//// WRITING ///////////////////////////////////////////////////////////=//
+
+typedef struct {
+    REBSER *bin;
+    REBMAP *symbols;  // WORD! => (ignored), the pair number is the symbol
+} REBIN_WRITER;
+
+
+inline static void Write_Rebin_Byte(REBIN_WRITER *w, REBYTE b) {
+    Append_Series(w->bin, &b, 1);
+}
+
+static void Write_Rebin_Varint(REBIN_WRITER *w, REBU64 u)
+{
+    REBYTE buf[10];
+    REBLEN n = 0;
+    while (u >= 0x80) {
+        buf[n++] = cast(REBYTE, u) | 0x80;
+        u >>= 7;
+    }
+    buf[n++] = cast(REBYTE, u);
+    Append_Series(w->bin, buf, n);
+}
+
+static void Write_Rebin_Decimal(REBIN_WRITER *w, REBDEC d)
+{
+    REBU64 bits;
+    memcpy(&bits, &d, 8);
+
+    REBYTE buf[8];
+    REBLEN n;
+    for (n = 0; n < 8; ++n, bits >>= 8)
+        buf[n] = cast(REBYTE, bits);
+    Append_Series(w->bin, buf, 8);
+}
+
+static void Write_Rebin_Bytes(REBIN_WRITER *w, const REBYTE *bp, REBSIZ size)
+{
+    Write_Rebin_Varint(w, size);
+    Append_Series(w->bin, bp, size);
+}
+
+static void Write_Rebin_Symbol(REBIN_WRITER *w, REBSTR *spelling)
+{
+    DECLARE_LOCAL (word);
+    Init_Word(word, spelling);
+
+    DECLARE_LOCAL (blank);
+    Init_Blank(blank);
+
+    const bool cased = true;  // keep the spelling, not just the canon form
+    REBLEN n = Find_Map_Entry(
+        w->symbols, word, SPECIFIED, blank, SPECIFIED, cased
+    );
+    Write_Rebin_Varint(w, n - 1);
+}
+
+// Reserve room for a 4-byte payload size, filled in by End_Rebin_Sized().
+//
+static REBLEN Begin_Rebin_Sized(REBIN_WRITER *w)
+{
+    REBYTE placeholder[4] = {0, 0, 0, 0};
+    Append_Series(w->bin, placeholder, 4);
+    return BIN_LEN(w->bin);
+}
+
+static void End_Rebin_Sized(REBIN_WRITER *w, REBLEN start)
+{
+    REBLEN size = BIN_LEN(w->bin) - start;
+    if (size > UINT32_MAX)
+        fail ("Nested value too large for REBIN serialization");
+
+    REBYTE *bp = BIN_AT(w->bin, start - 4);
+    bp[0] = cast(REBYTE, size);
+    bp[1] = cast(REBYTE, size >> 8);
+    bp[2] = cast(REBYTE, size >> 16);
+    bp[3] = cast(REBYTE, size >> 24);
+}
+
+
+//
+//  Write_Rebin_Value: C
+//
+static void Write_Rebin_Value(
+    REBIN_WRITER *w,
+    const RELVAL *v,
+    REBSPC *specifier,
+    REBLEN depth
+){
+    if (depth > REBIN_MAX_DEPTH)
+        fail ("Value is nested too deeply (or cyclic) to serialize");
+
+    REBYTE flags = GET_CELL_FLAG(v, NEWLINE_BEFORE)
+        ? REBIN_FLAG_NEWLINE_BEFORE
+        : 0;
+
+    enum Reb_Rebin_Tag tag;
+    switch (VAL_TYPE(v)) {
+      case REB_BLANK:
+        Write_Rebin_Byte(w, REBIN_BLANK | flags);
+        return;
+
+      case REB_LOGIC:
+        Write_Rebin_Byte(w, (VAL_LOGIC(v) ? REBIN_TRUE : REBIN_FALSE) | flags);
+        return;
+
+      case REB_INTEGER: {
+        REBI64 i = VAL_INT64(v);
+        Write_Rebin_Byte(w, REBIN_INTEGER | flags);
+        Write_Rebin_Varint(  // zigzag, so small negative numbers stay small
+            w, (cast(REBU64, i) << 1) ^ cast(REBU64, i >> 63)
+        );
+        return; }
+
+      case REB_DECIMAL:
+      case REB_PERCENT:
+        Write_Rebin_Byte(
+            w, (IS_DECIMAL(v) ? REBIN_DECIMAL : REBIN_PERCENT) | flags
+        );
+        Write_Rebin_Decimal(w, VAL_DECIMAL(v));
+        return;
+
+      case REB_CHAR:
+        Write_Rebin_Byte(w, REBIN_CHAR | flags);
+        Write_Rebin_Varint(w, VAL_CHAR(v));
+        return;
+
+      case REB_TEXT: tag = REBIN_TEXT; goto write_string;
+      case REB_FILE: tag = REBIN_FILE; goto write_string;
+      case REB_EMAIL: tag = REBIN_EMAIL; goto write_string;
+      case REB_URL: tag = REBIN_URL; goto write_string;
+      case REB_TAG: tag = REBIN_TAG; goto write_string;
+      case REB_ISSUE: tag = REBIN_ISSUE; goto write_string;
+
+      write_string: {
+        REBSIZ size;
+        const REBYTE *utf8 = VAL_UTF8_AT(&size, v);
+        Write_Rebin_Byte(w, tag | flags);
+        Write_Rebin_Bytes(w, utf8, size);
+        return; }
+
+      case REB_BINARY:
+        Write_Rebin_Byte(w, REBIN_BINARY | flags);
+        Write_Rebin_Bytes(w, VAL_BIN_AT(v), VAL_LEN_AT(v));
+        return;
+
+      case REB_WORD: tag = REBIN_WORD; goto write_word;
+      case REB_SET_WORD: tag = REBIN_SET_WORD; goto write_word;
+      case REB_GET_WORD: tag = REBIN_GET_WORD; goto write_word;
+      case REB_SYM_WORD: tag = REBIN_SYM_WORD; goto write_word;
+
+      write_word:
+        Write_Rebin_Byte(w, tag | flags);
+        Write_Rebin_Symbol(w, VAL_WORD_SPELLING(v));
+        return;
+
+      case REB_BLOCK: tag = REBIN_BLOCK; goto write_array;
+      case REB_GROUP: tag = REBIN_GROUP; goto write_array;
+
+      write_array: {
+        if (GET_ARRAY_FLAG(VAL_ARRAY(v), NEWLINE_AT_TAIL))
+            flags |= REBIN_FLAG_NEWLINE_AT_TAIL;
+        Write_Rebin_Byte(w, tag | flags);
+        Write_Rebin_Varint(w, VAL_LEN_AT(v));
+
+        REBLEN start = Begin_Rebin_Sized(w);
+        REBSPC *derived = Derive_Specifier(specifier, v);
+        RELVAL *item = VAL_ARRAY_AT(v);
+        for (; NOT_END(item); ++item)
+            Write_Rebin_Value(w, item, derived, depth + 1);
+        End_Rebin_Sized(w, start);
+        return; }
+
+      case REB_MAP: {
+        REBMAP *map = VAL_MAP(v);
+        Write_Rebin_Byte(w, REBIN_MAP | flags);
+        Write_Rebin_Varint(w, Length_Map(map));
+
+        REBLEN start = Begin_Rebin_Sized(w);
+        RELVAL *key = ARR_HEAD(MAP_PAIRLIST(map));
+        for (; NOT_END(key); key += 2) {
+            if (IS_NULLED(key + 1))
+                continue;  // removed entry
+            Write_Rebin_Value(w, key, SPECIFIED, depth + 1);
+            Write_Rebin_Value(w, key + 1, SPECIFIED, depth + 1);
+        }
+        End_Rebin_Sized(w, start);
+        return; }
+
+      case REB_OBJECT: {
+        REBCTX *c = VAL_CONTEXT(v);
+        REBVAL *key = CTX_KEYS_HEAD(c);
+
+        REBLEN count = 0;
+        for (; NOT_END(key); ++key) {
+            if (not Is_Param_Hidden(key))
+                ++count;
+        }
+
+        Write_Rebin_Byte(w, REBIN_OBJECT | flags);
+        Write_Rebin_Varint(w, count);
+
+        REBLEN start = Begin_Rebin_Sized(w);
+        key = CTX_KEYS_HEAD(c);
+        REBVAL *var = CTX_VARS_HEAD(c);
+        for (; NOT_END(key); ++key, ++var) {
+            if (Is_Param_Hidden(key))
+                continue;
+            Write_Rebin_Symbol(w, VAL_KEY_SPELLING(key));
+            if (IS_NULLED(var))
+                Write_Rebin_Byte(w, REBIN_NULL);
+            else
+                Write_Rebin_Value(w, var, SPECIFIED, depth + 1);
+        }
+        End_Rebin_Sized(w, start);
+        return; }
+
+      default:
+        fail (Error_Bad_Value_Core(v, specifier));
+    }
+}
+
+
+//=//// READING ///////////////////////////////////////////////////////////=//
+
+typedef struct {
+    const REBYTE *cp;
+    const REBYTE *end;
+    REBSTR **symbols;
+    REBLEN num_symbols;
+} REBIN_READER;
+
+
+static void Need_Rebin_Bytes(const REBIN_READER *r, REBSIZ size)
+{
+    if (cast(REBSIZ, r->end - r->cp) < size)
+        fail ("REBIN data is truncated or corrupt");
+}
+
+static REBU64 Read_Rebin_Varint(REBIN_READER *r)
+{
+    REBU64 u = 0;
+    REBLEN shift = 0;
+    while (true) {
+        Need_Rebin_Bytes(r, 1);
+        REBYTE b = *r->cp++;
+        if (shift == 63 and (b & 0x7E))
+            fail ("REBIN data is truncated or corrupt");
+        u |= cast(REBU64, b & 0x7F) << shift;
+        if (not (b & 0x80))
+            return u;
+        shift += 7;
+        if (shift > 63)
+            fail ("REBIN data is truncated or corrupt");
+    }
+}
+
+static REBLEN Read_Rebin_Length(REBIN_READER *r)
+{
+    REBU64 u = Read_Rebin_Varint(r);
+    if (u > cast(REBSIZ, r->end - r->cp))  // every item takes >= 1 byte
+        fail ("REBIN data is truncated or corrupt");
+    return cast(REBLEN, u);
+}
+
+static uint32_t Read_Rebin_Uint32(REBIN_READER *r)
+{
+    Need_Rebin_Bytes(r, 4);
+    const REBYTE *bp = r->cp;
+    r->cp += 4;
+    return cast(uint32_t, bp[0])
+        | (cast(uint32_t, bp[1]) << 8)
+        | (cast(uint32_t, bp[2]) << 16)
+        | (cast(uint32_t, bp[3]) << 24);
+}
+
+static REBSTR *Read_Rebin_Symbol(REBIN_READER *r)
+{
+    REBU64 n = Read_Rebin_Varint(r);
+    if (n >= r->num_symbols)
+        fail ("REBIN data is truncated or corrupt");
+    return r->symbols[n];
+}
+
+
+//
+//  Skip_Rebin_Value: C
+//
+// Step over a value without making anything.  Arrays, maps and objects are
+// skipped in one step using their payload size.
+//
+static void Skip_Rebin_Value(REBIN_READER *r)
+{
+    Need_Rebin_Bytes(r, 1);
+    REBYTE tag = *r->cp++ & REBIN_TAG_MASK;
+
+    switch (tag) {
+      case REBIN_NULL:
+      case REBIN_BLANK:
+      case REBIN_FALSE:
+      case REBIN_TRUE:
+        return;
+
+      case REBIN_INTEGER:
+      case REBIN_CHAR:
+      case REBIN_WORD:
+      case REBIN_SET_WORD:
+      case REBIN_GET_WORD:
+      case REBIN_SYM_WORD:
+        Read_Rebin_Varint(r);
+        return;
+
+      case REBIN_DECIMAL:
+      case REBIN_PERCENT:
+        Need_Rebin_Bytes(r, 8);
+        r->cp += 8;
+        return;
+
+      case REBIN_BLOCK:
+      case REBIN_GROUP:
+      case REBIN_MAP:
+      case REBIN_OBJECT: {
+        Read_Rebin_Varint(r);
+        uint32_t size = Read_Rebin_Uint32(r);
+        Need_Rebin_Bytes(r, size);
+        r->cp += size;
+        return; }
+
+      default:
+        if (tag >= REBIN_TEXT and tag <= REBIN_BINARY) {
+            REBLEN size = Read_Rebin_Length(r);
+            r->cp += size;
+            return;
+        }
+        fail ("REBIN data is truncated or corrupt");
+    }
+}
+
+
+//
+//  Read_Rebin_Value: C
+//
+// Values are decoded straight into their final cells.  Nothing here runs
+// the evaluator, so the unmanaged series being filled in can't be GC'd.
+//
+static void Read_Rebin_Value(RELVAL *out, REBIN_READER *r, REBLEN depth)
+{
+    if (depth > REBIN_MAX_DEPTH)
+        fail ("REBIN data is nested too deeply");
+
+    Need_Rebin_Bytes(r, 1);
+    REBYTE byte = *r->cp++;
+    REBYTE tag = byte & REBIN_TAG_MASK;
+
+    enum Reb_Kind kind;
+    switch (tag) {
+      case REBIN_BLANK:
+        Init_Blank(out);
+        break;
+
+      case REBIN_FALSE:
+        Init_Logic(out, false);
+        break;
+
+      case REBIN_TRUE:
+        Init_Logic(out, true);
+        break;
+
+      case REBIN_INTEGER: {
+        REBU64 u = Read_Rebin_Varint(r);
+        Init_Integer(out, cast(REBI64, (u >> 1) ^ (~(u & 1) + 1)));
+        break; }
+
+      case REBIN_DECIMAL:
+      case REBIN_PERCENT: {
+        Need_Rebin_Bytes(r, 8);
+        REBU64 bits = 0;
+        REBLEN n;
+        for (n = 8; n != 0; --n)
+            bits = (bits << 8) | r->cp[n - 1];
+        r->cp += 8;
+
+        REBDEC d;
+        memcpy(&d, &bits, 8);
+        if (tag == REBIN_DECIMAL)
+            Init_Decimal(out, d);
+        else
+            Init_Percent(out, d);
+        break; }
+
+      case REBIN_CHAR: {
+        REBU64 c = Read_Rebin_Varint(r);
+        if (c > MAX_UNI)
+            fail ("REBIN data is truncated or corrupt");
+        Init_Char_May_Fail(out, cast(REBUNI, c));
+        break; }
+
+      case REBIN_TEXT: kind = REB_TEXT; goto read_string;
+      case REBIN_FILE: kind = REB_FILE; goto read_string;
+      case REBIN_EMAIL: kind = REB_EMAIL; goto read_string;
+      case REBIN_URL: kind = REB_URL; goto read_string;
+      case REBIN_TAG: kind = REB_TAG; goto read_string;
+      case REBIN_ISSUE: kind = REB_ISSUE; goto read_string;
+
+      read_string: {
+        REBLEN size = Read_Rebin_Length(r);
+        REBSTR *s = Append_UTF8_May_Fail(  // validates the UTF-8
+            nullptr, cs_cast(r->cp), size, STRMODE_ALL_CODEPOINTS
+        );
+        r->cp += size;
+        Init_Any_String(out, kind, s);
+        break; }
+
+      case REBIN_BINARY: {
+        REBLEN size = Read_Rebin_Length(r);
+        REBSER *bin = Make_Binary(size);
+        memcpy(BIN_HEAD(bin), r->cp, size);
+        TERM_BIN_LEN(bin, size);
+        r->cp += size;
+        Init_Binary(out, bin);
+        break; }
+
+      case REBIN_WORD: kind = REB_WORD; goto read_word;
+      case REBIN_SET_WORD: kind = REB_SET_WORD; goto read_word;
+      case REBIN_GET_WORD: kind = REB_GET_WORD; goto read_word;
+      case REBIN_SYM_WORD: kind = REB_SYM_WORD; goto read_word;
+
+      read_word:
+        Init_Any_Word(out, kind, Read_Rebin_Symbol(r));
+        break;
+
+      case REBIN_BLOCK: kind = REB_BLOCK; goto read_array;
+      case REBIN_GROUP: kind = REB_GROUP; goto read_array;
+
+      read_array: {
+        REBLEN len = Read_Rebin_Length(r);
+        Read_Rebin_Uint32(r);  // payload size, only needed for skipping
+
+        REBARR *a = Make_Array(len);
+        RELVAL *item = ARR_HEAD(a);
+        REBLEN n;
+        for (n = 0; n < len; ++n, ++item)
+            Read_Rebin_Value(item, r, depth + 1);
+        TERM_ARRAY_LEN(a, len);
+        if (byte & REBIN_FLAG_NEWLINE_AT_TAIL)
+            SET_ARRAY_FLAG(a, NEWLINE_AT_TAIL);
+
+        Init_Any_Array(out, kind, a);
+        break; }
+
+      case REBIN_MAP: {
+        REBLEN count = Read_Rebin_Length(r);
+        Read_Rebin_Uint32(r);
+
+        REBMAP *map = Make_Map(count);
+        DECLARE_LOCAL (key);
+        DECLARE_LOCAL (val);
+        REBLEN n;
+        for (n = 0; n < count; ++n) {
+            Read_Rebin_Value(key, r, depth + 1);
+            Read_Rebin_Value(val, r, depth + 1);
+            const bool cased = true;
+            Find_Map_Entry(map, key, SPECIFIED, val, SPECIFIED, cased);
+        }
+        Init_Map(out, map);
+        break; }
+
+      case REBIN_OBJECT: {
+        REBLEN count = Read_Rebin_Length(r);
+        Read_Rebin_Uint32(r);
+
+        // See Alloc_Context(), built up like Make_Object_From_Map()
+        //
+        REBCTX *c = Alloc_Context(REB_OBJECT, count);
+        REBVAL *key = CTX_KEYS_HEAD(c);
+        REBVAL *var = CTX_VARS_HEAD(c);
+        REBLEN n;
+        for (n = 0; n < count; ++n, ++key, ++var) {
+            Init_Context_Key(key, Read_Rebin_Symbol(r));
+            if (r->cp != r->end and *r->cp == REBIN_NULL) {
+                ++r->cp;
+                Init_Nulled(var);
+            }
+            else
+                Read_Rebin_Value(var, r, depth + 1);
+        }
+        TERM_ARRAY_LEN(CTX_VARLIST(c), count + 1);
+        TERM_ARRAY_LEN(CTX_KEYLIST(c), count + 1);
+
+        Init_Object(out, c);
+        break; }
+
+      default:
+        fail ("REBIN data is truncated or corrupt");
+    }
+
+    if (byte & REBIN_FLAG_NEWLINE_BEFORE)
+        SET_CELL_FLAG(out, NEWLINE_BEFORE);
+}
+
+
+static bool Has_Rebin_Header(const REBYTE *bp, REBLEN len) {
+    return len >= 5 and memcmp(bp, "REBIN", 5) == 0;
+}
+
+
+//
+//  identify-rebin?: native [
+//
+//  {Codec for identifying BINARY! data for a REBIN serialization}
+//
+//      return: [logic!]
+//      data [binary!]
+//  ]
+//
+REBNATIVE(identify_rebin_q)
+{
+    REBIN_INCLUDE_PARAMS_OF_IDENTIFY_REBIN_Q;
+
+    return Init_Logic(
+        D_OUT,
+        Has_Rebin_Header(VAL_BIN_AT(ARG(data)), VAL_LEN_AT(ARG(data)))
+    );
+}
+
+
+//
+//  export encode-rebin: native [
+//
+//  {Serialize a data value to compact binary (see DECODE-REBIN)}
+//
+//      return: [binary!]
+//      value "Words are saved by spelling only, bindings are not kept"
+//          [any-value!]
+//  ]
+//
+REBNATIVE(encode_rebin)
+//
+// The output is: "REBIN", a version byte, the number of symbols, the symbols
+// (each a size and UTF-8 spelling), then the value.  As symbols are only
+// known after the value has been written, the value goes to its own buffer
+// first.
+{
+    REBIN_INCLUDE_PARAMS_OF_ENCODE_REBIN;
+
+    REBIN_WRITER writer;
+    REBIN_WRITER *w = &writer;
+    w->bin = Make_Binary(256);
+    w->symbols = Make_Map(64);
+
+    Write_Rebin_Value(w, ARG(value), SPECIFIED, 0);
+    REBSER *body = w->bin;
+
+    REBARR *pairlist = MAP_PAIRLIST(w->symbols);
+    w->bin = Make_Binary(BIN_LEN(body) + 16 + (ARR_LEN(pairlist) * 8));
+    Append_Series(w->bin, "REBIN", 5);
+    Write_Rebin_Byte(w, REBIN_VERSION);
+    Write_Rebin_Varint(w, ARR_LEN(pairlist) / 2);
+
+    RELVAL *word = ARR_HEAD(pairlist);
+    for (; NOT_END(word); word += 2) {
+        REBSTR *spelling = VAL_WORD_SPELLING(word);
+        Write_Rebin_Bytes(w, STR_HEAD(spelling), STR_SIZE(spelling));
+    }
+
+    Append_Series(w->bin, BIN_HEAD(body), BIN_LEN(body));
+    Free_Unmanaged_Series(body);
+
+    Free_Unmanaged_Series(MAP_HASHLIST(w->symbols));
+    Free_Unmanaged_Array(MAP_PAIRLIST(w->symbols));
+
+    return Init_Binary(D_OUT, w->bin);
+}
+
+
+//
+//  export decode-rebin: native [
+//
+//  {Make a data value from the output of ENCODE-REBIN}
+//
+//      return: [<opt> any-value!]
+//      data [binary!]
+//      /at "Only decode the nested value at these indexes, e.g. [3 2]"
+//          [block!]
+//  ]
+//
+REBNATIVE(decode_rebin)
+{
+    REBIN_INCLUDE_PARAMS_OF_DECODE_REBIN;
+
+    const REBYTE *bp = VAL_BIN_AT(ARG(data));
+    REBLEN len = VAL_LEN_AT(ARG(data));
+    if (not Has_Rebin_Header(bp, len))
+        fail ("Data is not in REBIN format");
+    if (len < 6 or bp[5] != REBIN_VERSION)
+        fail ("Unsupported REBIN version");
+
+    REBIN_READER reader;
+    REBIN_READER *r = &reader;
+    r->cp = bp + 6;
+    r->end = bp + len;
+
+    // Interned symbols aren't GC'd while being held here, since nothing in
+    // decoding runs the evaluator.
+    //
+    r->num_symbols = Read_Rebin_Length(r);
+    REBSER *symbols = Make_Series(r->num_symbols + 1, sizeof(REBSTR*));
+    r->symbols = SER_HEAD(REBSTR*, symbols);
+    REBLEN n;
+    for (n = 0; n < r->num_symbols; ++n) {
+        REBLEN size = Read_Rebin_Length(r);
+        r->symbols[n] = Intern_UTF8_Managed(r->cp, size);
+        r->cp += size;
+    }
+
+    if (REF(at)) {
+        RELVAL *index = VAL_ARRAY_AT(ARG(at));
+        for (; NOT_END(index); ++index) {
+            if (not IS_INTEGER(index) or VAL_INT64(index) < 1)
+                fail (Error_Bad_Value_Core(index, VAL_SPECIFIER(ARG(at))));
+            REBI64 i = VAL_INT64(index) - 1;
+
+            Need_Rebin_Bytes(r, 1);
+            REBYTE tag = *r->cp++ & REBIN_TAG_MASK;
+            REBI64 per_item;  // values to step over for each index
+            if (tag == REBIN_BLOCK or tag == REBIN_GROUP)
+                per_item = 1;
+            else if (tag == REBIN_MAP)
+                per_item = 2;  // position of the key/value pair's value
+            else if (tag == REBIN_OBJECT)
+                per_item = 1;  // (symbol is skipped separately)
+            else
+                fail ("DECODE-REBIN/AT can only index into containers");
+
+            REBLEN count = Read_Rebin_Length(r);
+            Read_Rebin_Uint32(r);
+            if (i >= cast(REBI64, count)) {
+                Free_Unmanaged_Series(symbols);
+                return nullptr;  // out of range
+            }
+
+            REBI64 skip;
+            for (skip = 0; skip < i; ++skip) {
+                if (tag == REBIN_OBJECT)
+                    Read_Rebin_Symbol(r);
+                REBI64 k;
+                for (k = 0; k < per_item; ++k)
+                    Skip_Rebin_Value(r);
+            }
+            if (tag == REBIN_OBJECT)
+                Read_Rebin_Symbol(r);
+            else if (tag == REBIN_MAP)
+                Skip_Rebin_Value(r);  // the key
+        }
+    }
+
+    if (r->cp != r->end and *r->cp == REBIN_NULL) {  // object var /AT
+        Free_Unmanaged_Series(symbols);
+        return nullptr;
+    }
+
+    Read_Rebin_Value(D_OUT, r, 0);
+    Free_Unmanaged_Series(symbols);
+
+    if (not REF(at) and r->cp != r->end)
+        fail ("Extra data after REBIN value");
+
+    return D_OUT;
+}
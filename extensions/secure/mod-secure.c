@@ -48,42 +48,399 @@ enum Reb_Security_Byte_Offsets {
 };
 
 
+//=//// COMPILED POLICIES ///////////////////////////////////////////////=//
 //
-//  Match_Sub_Path: C
+// Detailed policies like `file: [%/home/ allow %/home/secret/ throw]` used
+// to be scanned linearly on every check, comparing each path a codepoint at
+// a time.  Instead the block is compiled into a trie of lowercased path
+// components when it is first used after being set, and recent decisions
+// are remembered per directory.  (A directory scan then costs one lookup in
+// the decision cache per file, regardless of how many policies there are.)
 //
-// Compare two file path series and return true if s1 is a subpath of s2.
-// Case insensitive.
+// The compiled form is in malloc()'d memory, since it isn't Rebol data.  It
+// is thrown away when a different policy block is found in the policies
+// object, or when SECURE calls FORGET-POLICIES after changing them.
 //
-// !!! This C code would likely be better as Rebol in %ext-secure-init.reb
+
+#define MAX_COMPILED_POLICIES 8  // subsystems with detailed (block) policies
+
+struct Policy_Node {
+    uint32_t first_child;  // index of first child node, 0 if none
+    uint32_t next_sibling;  // index of next child of same parent, 0 if none
+    uint32_t comp_offset;  // lowercased UTF-8 path component in `bytes`
+    uint32_t comp_size;
+    bool has_flags;  // a policy path ends here
+    bool has_flags_sep;  // a policy path ends here with a separator
+    REBYTE flags[POL_MAX];
+    REBYTE flags_sep[POL_MAX];
+};
+
+struct Compiled_Policy {
+    REBSTR *subsystem;  // canon spelling, nullptr if this slot is unused
+    REBARR *source;  // block this was compiled from (not kept alive!)
+    REBLEN source_len;
+
+    REBYTE default_flags[POL_MAX];  // from the last WORD! entry...
+    bool has_default;  // ...if there was one
+
+    struct Policy_Node *nodes;  // nodes[0] is the root (no component)
+    uint32_t num_nodes;
+    uint32_t nodes_capacity;
+
+    REBYTE *bytes;  // path component spellings
+    uint32_t num_bytes;
+    uint32_t bytes_capacity;
+};
+
+static struct Compiled_Policy Compiled_Policies[MAX_COMPILED_POLICIES];
+
+
+#define NUM_DECISION_SLOTS 64
+#define MAX_DECISION_DIR_SIZE 240
+
+struct Policy_Decision {
+    struct Compiled_Policy *compiled;  // nullptr if this slot is unused
+    uint32_t hash;
+    uint32_t dir_size;
+    REBYTE dir[MAX_DECISION_DIR_SIZE];  // lowercased, up to last separator
+    const REBYTE *flags;
+};
+
+static struct Policy_Decision Policy_Decisions[NUM_DECISION_SLOTS];
+
+
+// Scratch space for lowercasing the path being checked.
+//
+static REBYTE *Path_Buffer;
+static uint32_t Path_Buffer_Capacity;
+
+
+inline static bool Is_Path_Separator(REBYTE b)
+  { return b == '/' or b == '\\'; }
+
+
+static void *Grow_Buffer(
+    void *p,
+    uint32_t *capacity,
+    uint32_t needed,
+    size_t wide
+){
+    if (needed <= *capacity)
+        return p;
+
+    uint32_t n = *capacity == 0 ? 16 : *capacity;
+    while (n < needed)
+        n *= 2;
+
+    void *grown = realloc(p, n * wide);
+    if (not grown)
+        fail (Error_No_Memory(n * wide));
+    *capacity = n;
+    return grown;
+}
+
+
+//
+//  Lowercase_Path_Utf8: C
+//
+// Put lowercased UTF-8 of a TEXT!/FILE!/URL! (from its head, as R3-Alpha
+// did) or BINARY! into Path_Buffer, and return the size.  BINARY! is taken
+// as UTF-8 and only its ASCII is lowercased (SECURE stores local file paths
+// that way on some platforms).
+//
+static REBSIZ Lowercase_Path_Utf8(const RELVAL *v)
+{
+    REBSIZ max = IS_BINARY(v)
+        ? VAL_LEN_HEAD(v)
+        : VAL_LEN_HEAD(v) * 4;  // UTF-8 can't take more than 4 bytes a char
+
+    Path_Buffer = cast(REBYTE*, Grow_Buffer(
+        Path_Buffer, &Path_Buffer_Capacity, max + 1, sizeof(REBYTE)
+    ));
+
+    REBYTE *dest = Path_Buffer;
+    if (IS_BINARY(v)) {
+        const REBYTE *bp = BIN_HEAD(VAL_SERIES(v));
+        REBLEN n;
+        for (n = 0; n < max; ++n)
+            *dest++ = (bp[n] >= 'A' and bp[n] <= 'Z') ? bp[n] + 32 : bp[n];
+    }
+    else {
+        REBCHR(const*) cp = STR_HEAD(VAL_STRING(v));
+        REBLEN len = VAL_LEN_HEAD(v);
+        for (; len > 0; --len) {
+            REBUNI c;
+            cp = NEXT_CHR(&c, cp);
+            c = LO_CASE(c);
+            uint_fast8_t size = Encoded_Size_For_Codepoint(c);
+            Encode_UTF8_Char(dest, c, size);
+            dest += size;
+        }
+    }
+    return dest - Path_Buffer;
+}
+
+
+static uint32_t Add_Policy_Node(
+    struct Compiled_Policy *c,
+    uint32_t parent,
+    const REBYTE *comp,
+    uint32_t comp_size
+){
+    uint32_t n = c->nodes[parent].first_child;
+    for (; n != 0; n = c->nodes[n].next_sibling) {
+        struct Policy_Node *node = &c->nodes[n];
+        if (
+            node->comp_size == comp_size
+            and 0 == memcmp(c->bytes + node->comp_offset, comp, comp_size)
+        ){
+            return n;
+        }
+    }
+
+    c->nodes = cast(struct Policy_Node*, Grow_Buffer(
+        c->nodes, &c->nodes_capacity, c->num_nodes + 1,
+        sizeof(struct Policy_Node)
+    ));
+    c->bytes = cast(REBYTE*, Grow_Buffer(
+        c->bytes, &c->bytes_capacity, c->num_bytes + comp_size + 1,
+        sizeof(REBYTE)
+    ));
+
+    n = c->num_nodes++;
+    struct Policy_Node *node = &c->nodes[n];
+    memset(node, 0, sizeof(struct Policy_Node));
+    node->comp_offset = c->num_bytes;
+    node->comp_size = comp_size;
+    memcpy(c->bytes + c->num_bytes, comp, comp_size);
+    c->num_bytes += comp_size;
+
+    node->next_sibling = c->nodes[parent].first_child;
+    c->nodes[parent].first_child = n;
+    return n;
+}
+
+
+static void Free_Compiled_Policy(struct Compiled_Policy *c)
+{
+    free(c->nodes);
+    free(c->bytes);
+    memset(c, 0, sizeof(struct Compiled_Policy));
+}
+
+
+//
+//  Forget_Policies: C
 //
-bool Match_Sub_Path(REBSTR *s1, REBSTR *s2)
+// Throw away all compiled policies and cached decisions.
+//
+void Forget_Policies(void)
 {
-    REBLEN len1 = STR_LEN(s1);
-    if (len1 > STR_LEN(s2))
-        return false;
+    REBLEN i;
+    for (i = 0; i < MAX_COMPILED_POLICIES; ++i)
+        Free_Compiled_Policy(&Compiled_Policies[i]);
 
-    REBCHR(const*) cp1 = STR_HEAD(s1);
-    REBCHR(const*) cp2 = STR_HEAD(s2);
-    REBUNI c1 = 0;
-    REBUNI c2;
+    for (i = 0; i < NUM_DECISION_SLOTS; ++i)
+        Policy_Decisions[i].compiled = nullptr;
+}
 
-    REBLEN n;
-    for (n = 0; n != len1; n++) {  // includes terminator
-        cp1 = NEXT_CHR(&c1, cp1);
-        cp2 = NEXT_CHR(&c2, cp2);
-        if (LO_CASE(c1) != LO_CASE(c2))
-            return false;  // all chars must match
+
+//
+//  Compile_Policy: C
+//
+// Build the trie for a block like [%file1 tuple-flags %file2 ... default
+// tuple-flags].  Errors are raised for a malformed block before anything is
+// changed, so a bad policy is rechecked (and fails) on each use.
+//
+static struct Compiled_Policy *Compile_Policy(
+    REBSTR *canon,
+    const REBVAL *policy
+){
+    const RELVAL *item = VAL_ARRAY_HEAD(policy);
+    for (; NOT_END(item); item += 2) {
+        if (IS_END(item + 1) or not IS_TUPLE(item + 1))  // must map to tuple
+            fail (policy);
+        if (not (
+            IS_WORD(item) or IS_TEXT(item) or IS_FILE(item) or IS_URL(item)
+            or IS_BINARY(item)
+        )){
+            fail (policy);
+        }
     }
 
-    // a/b matches: a/b, a/b/, a/b/c
+    // Reuse the slot for this subsystem, or take a free one (if there are
+    // none, start over...there are only a handful of subsystems).
     //
-    cp2 = NEXT_CHR(&c2, cp2);
-    return did (
-            n >= len1 // all chars matched
-            and  // Must be at end or at dir sep:
-            (c1 == '/' or c1 == '\\'
-            or c2 == 0 or c2 == '/' or c2 == '\\')
-    );
+    struct Compiled_Policy *c = nullptr;
+    REBLEN i;
+    for (i = 0; i < MAX_COMPILED_POLICIES; ++i) {
+        if (Compiled_Policies[i].subsystem == canon) {
+            c = &Compiled_Policies[i];
+            break;
+        }
+        if (not c and Compiled_Policies[i].subsystem == nullptr)
+            c = &Compiled_Policies[i];
+    }
+    if (not c) {
+        Forget_Policies();
+        c = &Compiled_Policies[0];
+    }
+    else
+        Free_Compiled_Policy(c);
+
+    for (i = 0; i < NUM_DECISION_SLOTS; ++i) {
+        if (Policy_Decisions[i].compiled == c)
+            Policy_Decisions[i].compiled = nullptr;
+    }
+
+    c->nodes = cast(struct Policy_Node*, Grow_Buffer(
+        nullptr, &c->nodes_capacity, 16, sizeof(struct Policy_Node)
+    ));
+    memset(&c->nodes[0], 0, sizeof(struct Policy_Node));
+    c->num_nodes = 1;
+
+    item = VAL_ARRAY_HEAD(policy);
+    for (; NOT_END(item); item += 2) {
+        const REBYTE *flags = VAL_TUPLE(item + 1);
+
+        if (IS_WORD(item)) {  // !!! Comment said "any word works here"
+            memcpy(c->default_flags, flags, POL_MAX);
+            c->has_default = true;
+            continue;
+        }
+
+        REBSIZ size = Lowercase_Path_Utf8(item);
+
+        // A path matches itself and anything under it: a/b matches a/b,
+        // a/b/ and a/b/c.  But a/b/ only matches when a separator follows.
+        //
+        bool sep = size > 0 and Is_Path_Separator(Path_Buffer[size - 1]);
+        if (sep)
+            --size;
+
+        uint32_t n = 0;
+        REBSIZ comp = 0;
+        REBSIZ at;
+        for (at = 0; at <= size; ++at) {
+            if (at == size or Is_Path_Separator(Path_Buffer[at])) {
+                n = Add_Policy_Node(c, n, Path_Buffer + comp, at - comp);
+                comp = at + 1;
+            }
+        }
+
+        // SECURE inserts new policies at the head, so the first one wins.
+        //
+        struct Policy_Node *node = &c->nodes[n];
+        if (sep and not node->has_flags_sep) {
+            node->has_flags_sep = true;
+            memcpy(node->flags_sep, flags, POL_MAX);
+        }
+        else if (not sep and not node->has_flags) {
+            node->has_flags = true;
+            memcpy(node->flags, flags, POL_MAX);
+        }
+    }
+
+    c->subsystem = canon;
+    c->source = VAL_ARRAY(policy);
+    c->source_len = VAL_LEN_HEAD(policy);
+    return c;
+}
+
+
+//
+//  Lookup_Compiled_Policy: C
+//
+// The longest path in the policy block that matches wins, and if none match
+// then the default (last WORD! entry) is used.  (R3-Alpha's linear scan
+// meant to pick the longest, but compared the length of the name being
+// checked instead of the matched path, so the last match won.)
+//
+static const REBYTE *Lookup_Compiled_Policy(
+    struct Compiled_Policy *c,
+    const REBVAL *policy,
+    const REBVAL *name
+){
+    const REBYTE *flags = c->has_default ? c->default_flags : nullptr;
+    if (not name)
+        goto done;
+
+  blockscope {
+    REBSIZ size = Lowercase_Path_Utf8(name);
+
+    REBSIZ dir_size = size;  // everything up to and including last separator
+    while (dir_size > 0 and not Is_Path_Separator(Path_Buffer[dir_size - 1]))
+        --dir_size;
+
+    uint32_t hash = 2166136261u;  // FNV-1a
+    REBSIZ i;
+    for (i = 0; i < dir_size; ++i)
+        hash = (hash ^ Path_Buffer[i]) * 16777619u;
+    hash ^= cast(uint32_t, cast(uintptr_t, c) >> 4);
+
+    struct Policy_Decision *d = &Policy_Decisions[hash % NUM_DECISION_SLOTS];
+    if (
+        d->compiled == c and d->hash == hash and d->dir_size == dir_size
+        and 0 == memcmp(d->dir, Path_Buffer, dir_size)
+    ){
+        return d->flags;
+    }
+
+    // Walk the trie one component at a time.  Every node passed through is
+    // a path that is a "subpath" of the name being checked.
+    //
+    uint32_t n = 0;
+    bool cacheable = true;
+    REBSIZ comp = 0;
+    REBSIZ at;
+    for (at = 0; at <= size; ++at) {
+        if (at != size and not Is_Path_Separator(Path_Buffer[at]))
+            continue;
+
+        uint32_t child = c->nodes[n].first_child;
+        for (; child != 0; child = c->nodes[child].next_sibling) {
+            struct Policy_Node *node = &c->nodes[child];
+            if (
+                node->comp_size == at - comp
+                and 0 == memcmp(
+                    c->bytes + node->comp_offset,
+                    Path_Buffer + comp,
+                    at - comp
+                )
+            ){
+                break;
+            }
+        }
+
+        if (comp == dir_size and c->nodes[n].first_child != 0)
+            cacheable = false;  // other names in the directory may differ
+
+        if (child == 0)
+            break;  // no deeper policies match
+
+        n = child;
+        struct Policy_Node *node = &c->nodes[n];
+        if (node->has_flags)
+            flags = node->flags;
+        if (node->has_flags_sep and at != size)  // separator follows
+            flags = node->flags_sep;
+        comp = at + 1;
+    }
+
+    if (flags and cacheable and dir_size <= MAX_DECISION_DIR_SIZE) {
+        d->compiled = c;
+        d->hash = hash;
+        d->dir_size = dir_size;
+        memcpy(d->dir, Path_Buffer, dir_size);
+        d->flags = flags;
+    }
+  }
+
+  done:
+    if (not flags)
+        fail (policy);
+
+    return flags;
 }
 
 
@@ -121,9 +478,10 @@ const REBYTE *Security_Policy(
     if (not IS_OBJECT(policies))
         fail (policies);
 
+    REBSTR *canon = STR_CANON(subsystem);
     const REBVAL *policy = Select_Canon_In_Context(
         VAL_CONTEXT(policies),
-        STR_CANON(subsystem)
+        canon
     );
     if (not policy) {
         DECLARE_LOCAL (word);
@@ -137,42 +495,28 @@ const REBYTE *Security_Policy(
     if (not IS_BLOCK(policy))  // only other form is detailed block
         fail (policy);
 
-    // Scan block of policies for the class: [file [allow read quit write]]
-
-    REBLEN len = 0;  // file or url length
-    const REBYTE *flags = 0;  // policy flags
-
+    // Detailed block: [file [allow read quit write]].  Use the compiled form
+    // unless it was made from some other block.
+    //
     // !!! Comment said "no relatives in STATE_POLICIES"
     //
-    const RELVAL *item = VAL_ARRAY_HEAD(policy);
-
-    for (; NOT_END(item); item += 2) {
-        if (IS_END(item + 1) or not IS_TUPLE(item + 1))  // must map to tuple
-            fail (policy);
-
-        if (IS_WORD(item)) { // !!! Comment said "any word works here"
-            if (len == 0)  // !!! "If no strings found, use the default"
-                flags = VAL_TUPLE(item + 1);
+    struct Compiled_Policy *c = nullptr;
+    REBLEN i;
+    for (i = 0; i < MAX_COMPILED_POLICIES; ++i) {
+        if (Compiled_Policies[i].subsystem == canon) {
+            c = &Compiled_Policies[i];
+            break;
         }
-        else if (name and (IS_TEXT(item) or IS_FILE(item))) {
-            //
-            // !!! Review doing with usermode code in %ext-secure-init.reb
-            //
-            if (Match_Sub_Path(VAL_STRING(item), VAL_STRING(name))) {
-                if (VAL_LEN_HEAD(name) >= len) {  // "Is the match adequate?"
-                    len = VAL_LEN_HEAD(name);
-                    flags = VAL_TUPLE(item + 1);
-                }
-            }
-        }
-        else
-            fail (policy);
+    }
+    if (
+        not c
+        or c->source != VAL_ARRAY(policy)
+        or c->source_len != VAL_LEN_HEAD(policy)
+    ){
+        c = Compile_Policy(canon, policy);
     }
 
-    if (flags == 0)
-        fail (policy);
-
-    return flags;
+    return Lookup_Compiled_Policy(c, policy, name);
 }
 
 
@@ -235,6 +579,48 @@ void Check_Security(
 }
 
 
+//
+//  export security-policy: native [
+//
+//  {Get the read, write and execute policy for a subsystem and target}
+//
+//      return: "Bytes are 0 (allow), 1 (ask), 2 (throw), 3 (quit)"
+//          [tuple!]
+//      subsystem "e.g. FILE or NET"
+//          [word!]
+//      target "File path or URL, if the subsystem has detailed policies"
+//          [<opt> file! url! text!]
+//  ]
+//
+REBNATIVE(security_policy)
+{
+    SECURE_INCLUDE_PARAMS_OF_SECURITY_POLICY;
+
+    const REBYTE *flags = Security_Policy(
+        VAL_WORD_SPELLING(ARG(subsystem)),
+        IS_NULLED(ARG(target)) ? nullptr : ARG(target)
+    );
+    return Init_Tuple(D_OUT, flags, POL_MAX);
+}
+
+
+//
+//  forget-policies: native [
+//
+//  {Discard compiled policies and cached decisions (SECURE calls this)}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(forget_policies)
+{
+    SECURE_INCLUDE_PARAMS_OF_FORGET_POLICIES;
+
+    Forget_Policies();
+    return Init_Void(D_OUT);
+}
+
+
 //
 //  init-secure: native [
 //
@@ -251,3 +637,28 @@ REBNATIVE(init_secure)
 
     return Init_Void(D_OUT);
 }
+
+
+//
+//  shutdown-secure: native [
+//
+//  {Free the compiled policies, decision cache, and path scratch space}
+//
+//      return: [void!]
+//  ]
+//
+REBNATIVE(shutdown_secure)
+//
+// These are malloc()'d, so unlike Rebol data they aren't freed by the core
+// when it shuts down.
+{
+    SECURE_INCLUDE_PARAMS_OF_SHUTDOWN_SECURE;
+
+    Forget_Policies();
+
+    free(Path_Buffer);
+    Path_Buffer = nullptr;
+    Path_Buffer_Capacity = 0;
+
+    return Init_Void(D_OUT);
+}
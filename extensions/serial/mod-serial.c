@@ -204,6 +204,12 @@ static REB_R Serial_Actor(REBFRM *frame_, REBVAL *port, const REBVAL *verb)
         // Determine length. Clip /PART to size of binary if needed.
 
         REBVAL *data = ARG(data);
+        if (IS_FILE(data)) {  // send the file's contents
+            REBVAL *bin = rebValue("read", data, rebEND);
+            Move_Value(data, bin);
+            rebRelease(bin);
+        }
+
         REBLEN len = VAL_LEN_AT(data);
         if (REF(part)) {
             REBLEN n = Int32s(ARG(part), 0);
@@ -411,7 +411,7 @@ bool Make_Vector_Spec(REBVAL *out, const RELVAL *head, REBSPC *specifier)
         ++item;
     }
 
-    REBYTE len = 1;  // !!! default len to 1...why?
+    REBLEN len = 1;  // !!! default len to 1...why?
     if (NOT_END(item) && IS_INTEGER(item)) {
         if (Int32(item) < 0)
             return false;
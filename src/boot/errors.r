@@ -45,6 +45,7 @@ Internal: [
     not-done:           {reserved for future use (or not yet implemented)}
 
     no-memory:          [{not enough memory:} :arg1 {bytes}]
+    over-budget:        [{evaluation went over its BUDGET for} :arg1]
 
     io-error:           {problem with IO}
     locked-series:      {locked series expansion}
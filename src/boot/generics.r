@@ -461,8 +461,8 @@ write: generic [
     {Writes to a file, URL, or port - auto-converts text strings}
 
     destination [port! file! url! block!]
-    data "Data to write (non-binary converts to UTF-8)"
-        [binary! text! block! object!]  ; !!! should this support CHAR!?
+    data "Data to write (non-binary converts to UTF-8, FILE! sends contents)"
+        [binary! text! file! block! object!]  ; !!! should this support CHAR!?
     /part "Partial write a given number of units"
         [any-number!]
     /seek "Write at a specific position"
@@ -138,6 +138,9 @@ options: make object! [  ; Options supplied to REBOL during startup
     file-types: copy [
         %.reb %.r3 %.r rebol
     ]
+
+    fold-pure: _    ; block of actions FUNC may precompute calls to, if literal
+    loop-hook: _    ; action offered loops that get hot (see %n-loop.c)
 ]
 
 script: make object! [
@@ -142,6 +142,10 @@ extension
 ;file -- already provided for FILE OF
 dir
 
+; Budget: (MEMORY is above, TIME is below)
+steps
+series
+
 ; Time:
 hour
 minute
@@ -1464,6 +1464,10 @@ REBVAL *RL_rebRescueWith(
 // computing world in general doesn't have great answers.  Ren-C is nothing
 // special in this regard, and more thought needs to be put into it!
 //
+// This only sets a bit in the pending signal word atomically, so it is safe
+// to call from a signal handler or another thread.  The evaluator will act
+// on it within EVAL_DOSE steps, if halting is not masked at the time.
+//
 void RL_rebHalt(void)
 {
     SET_SIGNAL(SIG_HALT);
@@ -1483,9 +1487,7 @@ void RL_rebHalt(void)
 //
 bool RL_rebWasHalting(void)
 {
-    bool halting = GET_SIGNAL(SIG_HALT);
-    CLR_SIGNAL(SIG_HALT);
-    return halting;
+    return TAKE_SIGNAL(SIG_HALT);
 }
 
 
@@ -1661,7 +1663,7 @@ REBVAL *RL_rebManage(REBVAL *v)
 
     SET_SERIES_FLAG(a, MANAGED);
     assert(not LINK(a).owner);
-    LINK(a).owner = NOD(Context_For_Frame_May_Manage(FS_TOP));
+    LINK(a).owner = NOD(Varlist_For_Api_Owner(FS_TOP));
 
     return v;
 }
@@ -1695,6 +1697,7 @@ void RL_rebUnmanage(void *p)
     //
     CLEAR_SERIES_FLAG(a, MANAGED);
     assert(GET_ARRAY_FLAG(LINK(a).owner, IS_VARLIST));
+    Disown_Api_Handle(ARR(LINK(a).owner));
     LINK(a).owner = UNBOUND;
 }
 
@@ -1739,7 +1742,8 @@ void *RL_rebZdeflateAlloc(
     size_t in_len
 ){
     REBSTR *envelope = Canon(SYM_ZLIB);
-    return Compress_Alloc_Core(out_len, input, in_len, envelope);
+    const int level = -1;  // Z_DEFAULT_COMPRESSION
+    return Compress_Alloc_Core(out_len, input, in_len, envelope, level);
 }
 
 
@@ -41,8 +41,6 @@
 
 #include "sys-core.h"
 
-#define EVAL_DOSE 10000
-
 
 //
 //  Ensure_Basics: C
@@ -949,6 +947,9 @@ static void Init_Contexts_Object(void)
 void Startup_Task(void)
 {
     Trace_Level = 0;
+    Trace_Ring = nullptr;
+    Trace_Ring_Size = 0;
+    Trace_Ring_Count = 0;
     Saved_State = 0;
 
     Eval_Cycles = 0;
@@ -1223,6 +1224,7 @@ void Startup_Core(void)
     Saved_State = NULL;
 
     Ensure_Basics();
+    Startup_Budgets();  // series allocation checks the budgets
 
 //=//// INITIALIZE MEMORY AND ALLOCATORS //////////////////////////////////=//
 
@@ -1484,6 +1486,7 @@ void Shutdown_Core(void)
     Recycle_Core(shutdown, NULL);
 
     Shutdown_Mold();
+    Shutdown_Trace();
     Shutdown_Collector();
     Shutdown_Raw_Print();
     Shutdown_CRC();
@@ -0,0 +1,287 @@
+//
+//  File: %c-budget.c
+//  Summary: "Limits on steps, time, and memory for an evaluation"
+//  Section: core
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2019 Rebol Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// BUDGET runs a block with limits on how many evaluator steps it may take,
+// how much processor time it may use, how many bytes of series it may make,
+// and how big any one series may get.  Going over raises an ordinary error,
+// so a script running untrusted code can use TRAP to find out:
+//
+//     trap [budget/steps/memory [...untrusted code...] 1000000 10000000]
+//
+// Budgets nest, with an inner BUDGET only able to tighten the outer ones.
+//
+// None of this adds work to each evaluator step:
+//
+// * Steps are counted by the Eval_Count countdown the evaluator already has.
+//   While a steps budget is in effect the dose is shortened, so that the
+//   first step past the budget runs Do_Signals_Throws() to fail.
+//
+// * Processor time is checked by Do_Signals_Throws(), so once per EVAL_DOSE
+//   steps.  This uses clock(), as it is standard C (and CPU time is what a
+//   quota for untrusted code is about).  A single long-running native is
+//   not interrupted; the time is noticed when it returns to the evaluator.
+//
+// * Memory is metered in the same places the GC's ballast is: series nodes
+//   and series data.  It counts everything made during the BUDGET, whether
+//   or not it has since been garbage collected.  Going over requests a poll
+//   of signals, so the error is raised at the next evaluator step and not
+//   in the middle of an allocation.
+//
+// * One native can make an arbitrarily big series before the evaluator gets
+//   a chance to complain about memory.  So the largest size of any series
+//   is checked before it is made or expanded, in the places where a failure
+//   for going over the 2GB series limit was already possible.
+//
+// Once a limit is passed, every step fails until the BUDGET is exited.  So
+// code that TRAPs the error can't use that to keep running.
+//
+
+#include "sys-core.h"
+
+#include <time.h>  // clock()
+
+
+//
+//  Startup_Budgets: C
+//
+void Startup_Budgets(void)
+{
+    TG_Budget_Steps_End = INT64_MAX;
+    TG_Budget_Clock_End = 0;
+    TG_Budget_Bytes_Left = INT64_MAX;
+    TG_Budget_Series_Max = INT32_MAX;  // series are limited to 2GB anyway
+}
+
+
+//
+//  Reset_Eval_Dose: C
+//
+// Credit the steps taken so far in this dose to Eval_Cycles, and start a new
+// countdown.  That's EVAL_DOSE steps, unless a BUDGET/STEPS runs out first.
+// If a budget is already blown, every step is polled.
+//
+void Reset_Eval_Dose(void)
+{
+    Eval_Cycles += Eval_Dose - Eval_Count;
+
+    REBI64 left = TG_Budget_Steps_End - Eval_Cycles;
+    if (left < 0 or TG_Budget_Bytes_Left < 0)
+        Eval_Dose = 1;
+    else if (left < EVAL_DOSE)
+        Eval_Dose = cast(uint_fast32_t, left + 1);  // poll on first step over
+    else
+        Eval_Dose = EVAL_DOSE;
+
+    Eval_Count = Eval_Dose;
+}
+
+
+//
+//  Over_Budget_Symbol: C
+//
+// Which limit of the innermost BUDGET has been exceeded (SYM_0 if none).
+// Assumes Eval_Cycles is current, e.g. that Reset_Eval_Dose() was called.
+//
+static REBSYM Over_Budget_Symbol(void)
+{
+    if (Eval_Cycles > TG_Budget_Steps_End)
+        return SYM_STEPS;
+
+    if (TG_Budget_Bytes_Left < 0)
+        return SYM_MEMORY;
+
+    if (
+        TG_Budget_Clock_End != 0
+        and cast(REBI64, clock()) >= TG_Budget_Clock_End
+    ){
+        return SYM_TIME;
+    }
+
+    return SYM_0;
+}
+
+
+//
+//  Error_Over_Budget: C
+//
+static REBCTX *Error_Over_Budget(REBSYM sym)
+{
+    DECLARE_LOCAL (limit);
+    Init_Word(limit, Canon(sym));
+    return Error_Over_Budget_Raw(limit);
+}
+
+
+//
+//  Check_Budget_May_Fail: C
+//
+// Called by Do_Signals_Throws().  If the budget is blown, the next dose is
+// cut to one step, so each step fails until the BUDGET has been left.
+//
+void Check_Budget_May_Fail(void)
+{
+    REBSYM sym = Over_Budget_Symbol();
+    if (sym == SYM_0)
+        return;
+
+    Eval_Dose = 1;
+    Eval_Count = 1;
+    fail (Error_Over_Budget(sym));
+}
+
+
+//
+//  Error_Series_Too_Big: C
+//
+// Series are limited to 2GB, which is reported as being out of memory.  If
+// the limit was lower, it came from BUDGET/SERIES.
+//
+REBCTX *Error_Series_Too_Big(REBU64 bytes)
+{
+    if (bytes <= INT32_MAX)
+        return Error_Over_Budget(SYM_SERIES);
+
+    return Error_No_Memory(cast(REBLEN, bytes));
+}
+
+
+// This is the code which is protected by the exception mechanism, so that
+// the budgets can be put back no matter how the block is exited.
+//
+static const REBVAL *Budget_Dangerous(REBFRM *frame_) {
+    INCLUDE_PARAMS_OF_BUDGET;
+
+    if (Do_Any_Array_At_Throws(D_OUT, ARG(code), SPECIFIED))
+        return VOID_VALUE;
+
+    return nullptr;
+}
+
+
+//
+//  budget: native [
+//
+//  {Evaluate a block, raising an error if it uses more than it is allowed}
+//
+//      return: [<opt> any-value!]
+//      code "Code to evaluate (limits of any enclosing BUDGET still apply)"
+//          [block!]
+//      /steps "Maximum number of evaluator steps"
+//          [integer!]
+//      /time "Maximum processor time, checked every few thousand steps"
+//          [time!]
+//      /memory "Maximum number of bytes of series to make (even if freed)"
+//          [integer!]
+//      /series "Maximum size of any one series, in bytes"
+//          [integer!]
+//  ]
+//
+REBNATIVE(budget)
+{
+    INCLUDE_PARAMS_OF_BUDGET;
+
+    REBI64 saved_steps_end = TG_Budget_Steps_End;
+    REBI64 saved_clock_end = TG_Budget_Clock_End;
+    REBI64 saved_bytes_left = TG_Budget_Bytes_Left;
+    REBU64 saved_series_max = TG_Budget_Series_Max;
+
+    if (REF(steps)) {
+        REBI64 steps = VAL_INT64(ARG(steps));
+        if (steps < 0)
+            fail (PAR(steps));
+
+        REBI64 end = Eval_Cycles + Eval_Dose - Eval_Count + steps;
+        if (end < TG_Budget_Steps_End)
+            TG_Budget_Steps_End = end;
+    }
+
+    if (REF(time)) {
+        REBI64 nanoseconds = VAL_NANO(ARG(time));
+        if (nanoseconds < 0)
+            fail (PAR(time));
+
+        REBI64 end = cast(REBI64, clock()) + cast(REBI64,
+            cast(REBDEC, nanoseconds) * CLOCKS_PER_SEC / SEC_SEC
+        );
+        if (TG_Budget_Clock_End == 0 or end < TG_Budget_Clock_End)
+            TG_Budget_Clock_End = end;
+    }
+
+    if (REF(memory)) {
+        REBI64 bytes = VAL_INT64(ARG(memory));
+        if (bytes < 0)
+            fail (PAR(memory));
+
+        if (bytes < TG_Budget_Bytes_Left)
+            TG_Budget_Bytes_Left = bytes;
+    }
+
+    if (REF(series)) {
+        REBI64 bytes = VAL_INT64(ARG(series));
+        if (bytes < 0)
+            fail (PAR(series));
+
+        if (cast(REBU64, bytes) < TG_Budget_Series_Max)
+            TG_Budget_Series_Max = cast(REBU64, bytes);
+    }
+
+    REBI64 bytes_start = TG_Budget_Bytes_Left;
+    Reset_Eval_Dose();  // a steps budget may need a shorter dose
+
+    REBVAL *error = rebRescue(cast(REBDNG*, &Budget_Dangerous), frame_);
+
+    // The last steps of the block may have blown the budget without going
+    // back to the evaluator to notice (e.g. a memory-hungry native).
+    //
+    Reset_Eval_Dose();
+    REBSYM sym = SYM_0;
+    if (not error)
+        sym = Over_Budget_Symbol();
+
+    // The enclosing budget pays for whatever memory was made in this one.
+    //
+    TG_Budget_Steps_End = saved_steps_end;
+    TG_Budget_Clock_End = saved_clock_end;
+    TG_Budget_Bytes_Left = saved_bytes_left - (
+        bytes_start - TG_Budget_Bytes_Left
+    );
+    TG_Budget_Series_Max = saved_series_max;
+
+    // The enclosing budget may allow longer doses (or may have been blown by
+    // the memory used in this one, and need every step polled).
+    //
+    Reset_Eval_Dose();
+
+    if (sym != SYM_0)
+        fail (Error_Over_Budget(sym));
+
+    if (not error)
+        return D_OUT;
+
+    if (IS_VOID(error))  // signal used to indicate a throw
+        return R_THROWN;
+
+    assert(IS_ERROR(error));
+    REBCTX *ctx = VAL_CONTEXT(error);
+    rebRelease(error);
+    fail (ctx);
+}
@@ -758,6 +758,79 @@ void Rebind_Context_Deep(
 }
 
 
+//
+//  Clear_Shape_Cache: C
+//
+void Clear_Shape_Cache(void)
+{
+    REBLEN i;
+    for (i = 0; i < NUM_SHAPE_CACHE_SLOTS; ++i)
+        TG_Shapes[i].keylist = nullptr;
+}
+
+
+inline static struct Reb_Shape *Shape_Slot(const RELVAL *head) {
+    uintptr_t p = cast(uintptr_t, head) / sizeof(RELVAL);
+    return &TG_Shapes[(p ^ (p >> 6)) % NUM_SHAPE_CACHE_SLOTS];
+}
+
+
+//
+//  Find_Shape: C
+//
+// Get a cached keylist for a parentless object from the top-level SET-WORD!s
+// at head, or nullptr.  (Any other kind of item is ignored when collecting
+// an object's keys, so only the set-words need to match.)
+//
+static REBARR *Find_Shape(const RELVAL *head)
+{
+    struct Reb_Shape *shape = Shape_Slot(head);
+    if (shape->keylist == nullptr or shape->head != head)
+        return nullptr;
+
+    REBLEN n = 0;
+    for (; NOT_END(head); ++head) {
+        const REBCEL *cell = VAL_UNESCAPED(head);  // collected if quoted, too
+        if (CELL_KIND(cell) != REB_SET_WORD)
+            continue;
+        if (n == shape->num_set_words)
+            return nullptr;
+        if (VAL_WORD_SPELLING(cell) != shape->spellings[n])
+            return nullptr;
+        ++n;
+    }
+    if (n != shape->num_set_words)
+        return nullptr;
+
+    return shape->keylist;
+}
+
+
+//
+//  Remember_Shape: C
+//
+static void Remember_Shape(const RELVAL *head, REBARR *keylist)
+{
+    struct Reb_Shape *shape = Shape_Slot(head);
+
+    REBLEN n = 0;
+    const RELVAL *item = head;
+    for (; NOT_END(item); ++item) {
+        const REBCEL *cell = VAL_UNESCAPED(item);
+        if (CELL_KIND(cell) != REB_SET_WORD)
+            continue;
+        if (n == MAX_SHAPE_SET_WORDS)
+            return;  // too big to cache, leave any prior entry as it was
+        shape->spellings[n] = VAL_WORD_SPELLING(cell);
+        ++n;
+    }
+
+    shape->head = head;
+    shape->keylist = keylist;
+    shape->num_set_words = n;
+}
+
+
 //
 //  Make_Selfish_Context_Detect_Managed: C
 //
@@ -786,12 +859,34 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     REBCTX *opt_parent
 ) {
     REBLEN self_index;
-    REBARR *keylist = Collect_Keylist_Managed(
-        &self_index,
-        head,
-        opt_parent,
-        COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
-    );
+    REBARR *keylist;
+
+    // The common case of making many parentless objects from the same spec
+    // (e.g. records in a loop) can skip collecting the keys with the binder
+    // and share one keylist across all the objects, see TG_Shapes.
+    //
+    if (opt_parent == nullptr and (keylist = Find_Shape(head)) != nullptr) {
+        self_index = 1;  // without a parent, SELF is always the first key
+      #if !defined(NDEBUG)
+        PG_Reb_Stats->Shape_Cache_Hits++;
+      #endif
+    }
+    else {
+        keylist = Collect_Keylist_Managed(
+            &self_index,
+            head,
+            opt_parent,
+            COLLECT_ONLY_SET_WORDS | COLLECT_ENSURE_SELF
+        );
+        if (opt_parent == nullptr) {
+            assert(self_index == 1);
+            LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+            Remember_Shape(head, keylist);
+          #if !defined(NDEBUG)
+            PG_Reb_Stats->Shape_Cache_Misses++;
+          #endif
+        }
+    }
 
     REBLEN len = ARR_LEN(keylist);
     REBARR *varlist = Make_Array_Core(
@@ -810,8 +905,12 @@ REBCTX *Make_Selfish_Context_Detect_Managed(
     // obvious what's going on.
     //
     if (opt_parent == NULL) {
-        INIT_CTX_KEYLIST_UNIQUE(context, keylist);
-        LINK_ANCESTOR_NODE(keylist) = NOD(keylist);
+        //
+        // Whether or not this keylist came from the shape cache, it may be
+        // used by other objects later.  So mark it shared, which makes any
+        // object that expands its keys (or hides one) get its own copy.
+        //
+        INIT_CTX_KEYLIST_SHARED(context, keylist);
     }
     else {
         if (keylist == CTX_KEYLIST(opt_parent)) {
@@ -50,6 +50,7 @@ void Snap_State_Core(struct Reb_State *s)
     s->manuals_len = SER_LEN(GC_Manuals);
     s->mold_buf_len = STR_LEN(STR(MOLD_BUF));
     s->mold_buf_size = STR_SIZE(STR(MOLD_BUF));
+    s->mold_depth = TG_Mold_Depth;
     s->mold_loop_tail = ARR_LEN(TG_Mold_Stack);
 
     s->saved_sigmask = Eval_Sigmask;
@@ -128,6 +129,7 @@ void Assert_State_Balanced_Debug(
 
     assert(s->mold_buf_len == STR_LEN(STR(MOLD_BUF)));
     assert(s->mold_buf_size == STR_SIZE(STR(MOLD_BUF)));
+    assert(s->mold_depth == TG_Mold_Depth);
     assert(s->mold_loop_tail == ARR_LEN(TG_Mold_Stack));
 
     assert(s->saved_sigmask == Eval_Sigmask);  // !!! is this always true?
@@ -187,6 +189,7 @@ void Trapped_Helper(struct Reb_State *s)
     SET_SERIES_LEN(GC_Guarded, s->guarded_len);
     TG_Top_Frame = s->frame;
     TERM_STR_LEN_SIZE(STR(MOLD_BUF), s->mold_buf_len, s->mold_buf_size);
+    TG_Mold_Depth = s->mold_depth;
 
   #if !defined(NDEBUG)
     //
@@ -1268,6 +1268,499 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
 }
 
 
+// The folding of calls to pure actions in function bodies is optional, and
+// is enabled by putting ACTION!s in `system/options/fold-pure`.  When FUNC
+// (or MAKE ACTION!) sees a call to one of those actions in the body with
+// all literal arguments, e.g. `1024 * 1024` or `to integer! "42"`, it runs
+// it once and keeps a copy of the body with the call replaced by the result.
+//
+// Words like `*` or `integer!` can be redefined after the action is made.
+// So the words the folding depended on are kept along with what they looked
+// up to, and each call checks them before using the folded body.  If any
+// changed, the original body runs instead.
+//
+// Only calls at the top level of the body (or in GROUP!s there) are folded,
+// because a BLOCK! might be data and not code.  Folding is conservative
+// about what is before and after a call: in `x + 1 * 2`, the `1` is the
+// right hand side of the `+`, not the start of an expression to fold.
+//
+
+// Both generics and usermode actions share dispatchers, so matching the
+// dispatcher is not enough.  But a COPY of an action (which is how ENFIXED
+// makes `*` from MULTIPLY) has the same dispatcher and details, and should
+// be considered pure if the original is.
+//
+static bool Is_Pure_Action(REBACT *act, const REBVAL *pure_list)
+{
+    RELVAL *body = ARR_HEAD(ACT_DETAILS(act));
+
+    RELVAL *item = VAL_ARRAY_AT(pure_list);
+    for (; NOT_END(item); ++item) {
+        if (not IS_ACTION(item))
+            continue;
+
+        REBACT *pure = VAL_ACTION(item);
+        if (pure == act)
+            return true;
+
+        if (ACT_DISPATCHER(pure) != ACT_DISPATCHER(act))
+            continue;
+
+        RELVAL *pure_body = ARR_HEAD(ACT_DETAILS(pure));
+        if (ACT_DISPATCHER(act) == &Generic_Dispatcher) {
+            if (VAL_WORD_CANON(body) == VAL_WORD_CANON(pure_body))
+                return true;
+        }
+        else if (GET_ACTION_FLAG(act, IS_NATIVE))
+            return true;  // each native has its own dispatcher
+        else if (IS_BLOCK(body) and IS_BLOCK(pure_body)) {
+            if (VAL_ARRAY(body) == VAL_ARRAY(pure_body))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+
+// Returns how many arguments a call to the action takes, or -1 if it takes
+// any arguments that aren't simply evaluated (quoted, variadic, etc.)
+//
+static REBINT Fold_Arity(REBACT *act)
+{
+    REBINT arity = 0;
+
+    REBVAL *param = ACT_PARAMS_HEAD(act);
+    for (; NOT_END(param); ++param) {
+        switch (VAL_PARAM_CLASS(param)) {
+          case REB_P_NORMAL:
+            if (Is_Param_Hidden(param))
+                break;  // specialized out
+            if (Is_Param_Variadic(param) or Is_Param_Skippable(param))
+                return -1;
+            ++arity;
+            break;
+
+          case REB_P_HARD_QUOTE:
+          case REB_P_MODAL:
+          case REB_P_SOFT_QUOTE:
+            return -1;
+
+          default:  // locals, RETURN, refinements (not used by a plain WORD!)
+            break;
+        }
+    }
+
+    return arity;
+}
+
+
+// The ACTION! a WORD! in a body refers to at the time of folding.  Words
+// bound to the action's own arguments and locals can't be known.
+//
+static REBACT *Try_Get_Fold_Action(const RELVAL *v)
+{
+    if (not IS_WORD(v) or IS_RELATIVE(v))
+        return nullptr;
+
+    const REBVAL *var = Try_Get_Opt_Var(v, SPECIFIED);
+    if (not var or not IS_ACTION(var))
+        return nullptr;
+
+    return VAL_ACTION(var);
+}
+
+
+// Actions with a quoted parameter after the first one could quote something
+// anywhere later in the array (`foo 1 + 2 3 * 4` could be quoting the `3`),
+// so arrays which call them aren't folded.
+//
+static bool Calls_Late_Quoting_Action(REBARR *array)
+{
+    RELVAL *item = ARR_HEAD(array);
+    for (; NOT_END(item); ++item) {
+        REBACT *act = Try_Get_Fold_Action(item);
+        if (not act)
+            continue;
+
+        bool first = true;
+        REBVAL *param = ACT_PARAMS_HEAD(act);
+        for (; NOT_END(param); ++param) {
+            Reb_Param_Class pclass = VAL_PARAM_CLASS(param);
+            if (
+                pclass == REB_P_HARD_QUOTE
+                or pclass == REB_P_MODAL
+                or pclass == REB_P_SOFT_QUOTE
+            ){
+                if (not first)
+                    return true;
+            }
+            if (pclass != REB_P_LOCAL and pclass != REB_P_RETURN)
+                first = false;
+        }
+    }
+    return false;
+}
+
+
+// Could the item before an expression keep it from being evaluated on its
+// own?  If the expression starts with a literal that an enfix action will
+// be run on, it could be the right hand side of a previous enfix action.
+//
+static bool Is_Fold_Blocked_By_Prev(const RELVAL *prev, bool enfix)
+{
+    if (not prev)
+        return false;
+
+    if (IS_PATH(prev))
+        return true;  // could be a call quoting its first argument
+
+    if (IS_WORD(prev) and IS_RELATIVE(prev))
+        return true;  // argument or local, could hold any action
+
+    REBACT *act = Try_Get_Fold_Action(prev);
+    if (not act)
+        return false;
+
+    if (GET_ACTION_FLAG(act, QUOTES_FIRST))
+        return true;
+
+    return enfix and GET_ACTION_FLAG(act, ENFIXED);
+}
+
+
+// Could the item after an expression make it evaluate differently?  After a
+// prefix call, an enfix action would take its last argument from the left.
+// After an enfix call, another enfix action is fine (they go left to right)
+// unless it quotes its left argument.
+//
+static bool Is_Fold_Blocked_By_Next(const RELVAL *next, bool enfix)
+{
+    if (IS_END(next))
+        return false;
+
+    if (IS_PATH(next))
+        return true;
+
+    if (IS_WORD(next) and IS_RELATIVE(next))
+        return true;
+
+    REBACT *act = Try_Get_Fold_Action(next);
+    if (not act or not GET_ACTION_FLAG(act, ENFIXED))
+        return false;
+
+    return not enfix or GET_ACTION_FLAG(act, QUOTES_FIRST);
+}
+
+
+// Remember what a word looked up to, so it can be checked before each run of
+// the folded body.  (Each word only needs to be checked once.)
+//
+static void Add_Fold_Guard(
+    REBARR *guards,
+    const RELVAL *word,
+    const REBVAL *var
+){
+    RELVAL *guard = ARR_HEAD(guards);
+    for (; NOT_END(guard); guard += 2) {
+        if (
+            VAL_BINDING(guard) == VAL_BINDING(word)
+            and VAL_WORD_INDEX(guard) == VAL_WORD_INDEX(word)
+        ){
+            return;
+        }
+    }
+
+    Derelativize(Alloc_Tail_Array(guards), word, SPECIFIED);
+    Move_Value(Alloc_Tail_Array(guards), var);
+}
+
+
+// Literal arguments are those that evaluate to themselves, and don't have
+// bindings relative to the action (so can't be arrays from the body).  A
+// WORD! looked up to a DATATYPE! is also accepted, with a guard added.
+//
+static bool Did_Get_Fold_Arg(
+    RELVAL *out,
+    const RELVAL *v,
+    REBARR *guards
+){
+    if (IS_WORD(v) and not IS_RELATIVE(v)) {
+        const REBVAL *var = Try_Get_Opt_Var(v, SPECIFIED);
+        if (not var or not IS_DATATYPE(var))
+            return false;
+
+        Add_Fold_Guard(guards, v, var);
+        Move_Value(out, var);
+        return true;
+    }
+
+    if (KIND_BYTE(v) < REB_BLANK or not ANY_INERT(v))
+        return false;  // also rules out QUOTED! (evaluation drops a quote)
+
+    if (ANY_ARRAY(v) or IS_RELATIVE(v))
+        return false;
+
+    Derelativize(out, v, SPECIFIED);
+    return true;
+}
+
+
+struct Reb_Fold_Call {
+    REBVAL *out;
+    REBARR *code;  // [action arg1 arg2 ...], all specific
+};
+
+static REBVAL *Fold_Call_Dangerous(struct Reb_Fold_Call *call)
+{
+    if (Do_At_Mutable_Throws(call->out, call->code, 0, SPECIFIED))
+        fail (Error_No_Catch_For_Throw(call->out));
+
+    return nullptr;
+}
+
+
+// See if a call to a pure action starts at `index`, either in prefix form
+// (`to integer! "42"`) or with an enfix action after the first argument
+// (`1024 * 1024`).  If so, run it and put the result in its place.
+//
+static bool Did_Fold_At(
+    REBARR *array,
+    REBLEN index,
+    const REBVAL *pure_list,
+    REBARR *guards
+){
+    RELVAL *at = ARR_AT(array, index);
+    RELVAL *prev = (index == 0) ? nullptr : at - 1;
+
+    REBACT *act = Try_Get_Fold_Action(at);
+    const RELVAL *word;
+    bool enfix;
+    if (act and not GET_ACTION_FLAG(act, ENFIXED)) {
+        word = at;
+        enfix = false;
+    }
+    else if (NOT_END(at) and NOT_END(at + 1)) {
+        act = Try_Get_Fold_Action(at + 1);
+        if (not act or not GET_ACTION_FLAG(act, ENFIXED))
+            return false;
+        word = at + 1;
+        enfix = true;
+    }
+    else
+        return false;
+
+    if (
+        GET_ACTION_FLAG(act, DEFERS_LOOKBACK)
+        or GET_ACTION_FLAG(act, POSTPONES_ENTIRELY)
+        or GET_ACTION_FLAG(act, IS_INVISIBLE)
+    ){
+        return false;
+    }
+
+    REBINT arity = Fold_Arity(act);
+    if (arity < 0 or (enfix and arity != 2))
+        return false;
+
+    REBLEN span = 1 + arity;  // action word, plus the arguments
+    if (index + span > ARR_LEN(array))
+        return false;
+
+    if (Is_Fold_Blocked_By_Prev(prev, enfix))
+        return false;
+    if (Is_Fold_Blocked_By_Next(at + span, enfix))
+        return false;
+
+    if (not Is_Pure_Action(act, pure_list))
+        return false;
+
+    // Arguments may add guards before it turns out the call can't be folded,
+    // so roll back to here in that case.
+    //
+    REBLEN guards_len = ARR_LEN(guards);
+
+    REBARR *code = Make_Array_Core(span, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(code);
+
+    // Put the ACTION! itself in the code to run, so it runs as prefix even
+    // if it is enfix.
+    //
+    const REBVAL *action_var = Try_Get_Opt_Var(word, SPECIFIED);
+    Move_Value(ARR_HEAD(code), action_var);
+
+    RELVAL *dest = ARR_AT(code, 1);
+    RELVAL *src = at;
+    REBLEN n;
+    for (n = 0; n < span; ++n, ++src) {
+        if (src == word)
+            continue;
+        if (not Did_Get_Fold_Arg(dest, src, guards))
+            break;
+        ++dest;
+    }
+
+    bool folded = false;
+
+    if (n == span) {
+        TERM_ARRAY_LEN(code, span);
+
+        DECLARE_LOCAL (result);
+        SET_END(result);
+        PUSH_GC_GUARD(result);
+
+        // Things like `1 / 0` will fail at runtime as well, they just don't
+        // get folded.
+        //
+        struct Reb_Fold_Call call;
+        call.out = result;
+        call.code = code;
+        REBVAL *error = rebRescue(cast(REBDNG*, &Fold_Call_Dangerous), &call);
+        if (error)
+            rebRelease(error);
+        else if (
+            KIND_BYTE(result) >= REB_BLANK
+            and ANY_INERT(result)  // not an ACTION! (would run), etc.
+        ){
+            if (ANY_SERIES(result) or IS_BITSET(result) or IS_MAP(result))
+                Constify(result);  // shared by every call now
+
+            bool newline = GET_CELL_FLAG(at, NEWLINE_BEFORE);
+            Move_Value(at, result);
+            if (newline)
+                SET_CELL_FLAG(at, NEWLINE_BEFORE);
+            else
+                CLEAR_CELL_FLAG(at, NEWLINE_BEFORE);
+
+            Remove_Series_Units(SER(array), index + 1, span - 1);
+
+            Add_Fold_Guard(guards, word, action_var);
+            folded = true;
+        }
+
+        DROP_GC_GUARD(result);
+    }
+
+    if (not folded)
+        TERM_ARRAY_LEN(guards, guards_len);
+
+    DROP_GC_GUARD(code);
+    return folded;
+}
+
+
+static REBLEN Fold_Pure_Calls_In_Array(
+    REBARR *array,
+    const REBVAL *pure_list,
+    REBARR *guards
+){
+    if (Calls_Late_Quoting_Action(array))
+        return 0;
+
+    REBLEN num_folds = 0;
+
+    bool changed;
+    do {  // folding `1 + 2` in `1 + 2 * 3` makes `3 * 3` foldable
+        changed = false;
+
+        REBLEN index = 0;
+        for (; index < ARR_LEN(array); ++index) {
+            RELVAL *at = ARR_AT(array, index);
+            if (IS_GROUP(at)) {
+                const RELVAL *prev = (index == 0) ? nullptr : at - 1;
+                if (Is_Fold_Blocked_By_Prev(prev, false))
+                    continue;
+                num_folds += Fold_Pure_Calls_In_Array(
+                    VAL_ARRAY(at),
+                    pure_list,
+                    guards
+                );
+                continue;
+            }
+
+            while (Did_Fold_At(array, index, pure_list, guards)) {
+                ++num_folds;
+                changed = true;
+            }
+        }
+    } while (changed);
+
+    return num_folds;
+}
+
+
+// Called on a new interpreted action if `system/options/fold-pure` is a
+// BLOCK! of ACTION!s.  See notes above.
+//
+static void Fold_Pure_Calls(REBACT *a, const REBVAL *pure_list)
+{
+    REBARR *details = ACT_DETAILS(a);
+    RELVAL *body = ARR_AT(details, IDX_NATIVE_BODY);
+    assert(ARR_LEN(details) == IDX_NATIVE_BODY + 1);
+
+    // Running the pure actions may trigger a GC, and nothing refers to the
+    // action being made yet.
+    //
+    PUSH_GC_GUARD(a);
+
+    REBARR *folded = Copy_Rerelativized_Array_Deep_Managed(
+        VAL_ARRAY(body),
+        a,
+        a
+    );
+    PUSH_GC_GUARD(folded);
+
+    REBARR *guards = Make_Array_Core(2, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(guards);
+
+    REBLEN num_folds = Fold_Pure_Calls_In_Array(folded, pure_list, guards);
+
+    DROP_GC_GUARD(guards);
+    DROP_GC_GUARD(folded);
+    DROP_GC_GUARD(a);
+
+    if (num_folds == 0)
+        return;  // copies will be GC'd
+
+    if (GET_ARRAY_FLAG(VAL_ARRAY(body), HAS_FILE_LINE_UNMASKED)) {
+        LINK_FILE_NODE(folded) = LINK_FILE_NODE(VAL_ARRAY(body));
+        MISC(folded).line = MISC(VAL_ARRAY(body)).line;
+        SET_ARRAY_FLAG(folded, HAS_FILE_LINE_UNMASKED);
+    }
+
+    bool is_const = GET_CELL_FLAG(body, CONST);  // details may move, below
+
+    RELVAL *rebound = Init_Relative_Block(Alloc_Tail_Array(details), a, folded);
+    if (is_const)
+        SET_CELL_FLAG(rebound, CONST);
+
+    Init_Block(Alloc_Tail_Array(details), guards);
+    assert(ARR_LEN(details) == IDX_FOLDED_MAX);
+}
+
+
+// Check that the words a folded body depended on still look up to the same
+// actions and datatypes they did when the action was made.
+//
+static bool Fold_Guards_Hold(REBARR *details, REBSPC *specifier)
+{
+    RELVAL *guard = ARR_HEAD(VAL_ARRAY(ARR_AT(details, IDX_FOLD_GUARDS)));
+    for (; NOT_END(guard); guard += 2) {
+        const REBVAL *var = Try_Get_Opt_Var(guard, specifier);
+        const RELVAL *expected = guard + 1;
+        if (not var or VAL_TYPE(var) != VAL_TYPE(expected))
+            return false;
+
+        if (IS_ACTION(expected)) {
+            if (VAL_ACTION(var) != VAL_ACTION(expected))
+                return false;
+        }
+        else if (VAL_TYPE_KIND(var) != VAL_TYPE_KIND(expected))
+            return false;
+    }
+    return true;
+}
+
+
 //
 //  Make_Interpreted_Action_May_Fail: C
 //
@@ -1421,6 +1914,12 @@ REBACT *Make_Interpreted_Action_May_Fail(
     if (GET_CELL_FLAG(body, CONST))
         SET_CELL_FLAG(rebound, CONST);  // Inherit_Const() would need REBVAL*
 
+    if (Root_System) {  // functions are made while %sysobj.r is running
+        REBVAL *pure_list = Get_System(SYS_OPTIONS, OPTIONS_FOLD_PURE);
+        if (IS_BLOCK(pure_list) and VAL_LEN_AT(pure_list) != 0)
+            Fold_Pure_Calls(a, pure_list);
+    }
+
     return a;
 }
 
@@ -1588,6 +2087,13 @@ inline static bool Interpreted_Dispatch_Throws(
     RELVAL *body = ARR_HEAD(details);  // usually CONST (doesn't have to be)
     assert(IS_BLOCK(body) and IS_RELATIVE(body) and VAL_INDEX(body) == 0);
 
+    if (
+        ARR_LEN(details) == IDX_FOLDED_MAX
+        and Fold_Guards_Hold(details, SPC(f->varlist))
+    ){
+        body = ARR_AT(details, IDX_FOLDED_BODY);  // see Fold_Pure_Calls()
+    }
+
     // The function body contains relativized words, that point to the
     // paramlist but do not have an instance of an action to line them up
     // with.  We use the frame (identified by varlist) as the "specifier".
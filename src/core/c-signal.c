@@ -50,7 +50,7 @@
 //
 //  Do_Signals_Throws: C
 //
-// !!! R3-Alpha's evaluator loop had a countdown (Eval_Count) which was
+// R3-Alpha's evaluator loop had a countdown (Eval_Count) which was
 // decremented on every step.  When this counter reached zero, it would call
 // this routine to process any "signals"...which could be requests for
 // garbage collection, network-related, Ctrl-C being hit, etc.
@@ -59,12 +59,12 @@
 // every step.  If it was, then it would always call this routine--regardless
 // of the Eval_Count.
 //
-// While a broader review of how signals would work in Ren-C is pending, it
-// seems best to avoid checking two things each step.  So only the Eval_Count
-// is checked, and places that set Eval_Signals set it to 1...to have the
-// same effect as if it were being checked.  Then if the Eval_Signals are
-// not cleared by the end of this routine, it resets the Eval_Count to 1
-// rather than giving it the full EVAL_DOSE of counts until next call.
+// To avoid checking two things each step, only the Eval_Count is checked.
+// Asynchronous sources (signal handlers, other threads) only set a bit in
+// the pending signal word and are picked up when the countdown runs out, so
+// they wait at most EVAL_DOSE steps.  Code on the evaluator thread that
+// needs a prompt answer uses SET_SIGNAL_AND_POLL(), which shortens the dose
+// after banking the steps already taken.  (See notes on SET_SIGNAL().)
 //
 // Currently the ability of a signal to THROW comes from the processing of
 // breakpoints.  The RESUME instruction is able to execute code with /DO,
@@ -72,17 +72,15 @@
 //
 bool Do_Signals_Throws(REBVAL *out)
 {
-    // !!! When it was the case that the only way Do_Signals_Throws would run
-    // due to the Eval_Count reaching the end of an Eval_Dose, this way of
-    // doing "CPU quota" would work.  Currently, however, it is inaccurate,
-    // due to the fact that Do_Signals_Throws can be queued to run by setting
-    // the Eval_Count to 1 for a specific signal.  Review.
+    // Only the evaluator thread writes Eval_Count and Eval_Dose, and anything
+    // that shortens a dose banks the steps taken so far first.  So this is
+    // an exact count of steps for the "CPU quota".
     //
-    Eval_Cycles += Eval_Dose - Eval_Count;
+    Reset_Eval_Dose();
     if (Eval_Limit != 0 and Eval_Cycles > Eval_Limit)
         Check_Security_Placeholder(Canon(SYM_EVAL), SYM_EXEC, 0);
 
-    Eval_Count = Eval_Dose;
+    Check_Budget_May_Fail();  // BUDGET limits apply even with signals masked
 
     bool thrown = false;
 
@@ -92,7 +90,7 @@ bool Do_Signals_Throws(REBVAL *out)
     //
     // !!! This seems overdesigned considering SIG_EVENT_PORT isn't used.
     //
-    REBFLGS filtered_sigs = Eval_Signals & Eval_Sigmask;
+    REBFLGS filtered_sigs = Load_Signals() & Eval_Sigmask;
     REBFLGS saved_sigmask = Eval_Sigmask;
     Eval_Sigmask = 0;
 
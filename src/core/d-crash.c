@@ -89,6 +89,10 @@ ATTRIBUTE_NO_RETURN void Panic_Core(
     Dump_Stack(FS_TOP, 0);
   #endif
 
+  #if !defined(NDEBUG)
+    Dump_Trace_Ring_Debug();  // if TRACE/RECORD was on, save what led here
+  #endif
+
   #if !defined(NDEBUG) && defined(HAVE_EXECINFO_AVAILABLE)
     void *backtrace_buf[1024];
     int n_backtrace = backtrace(  // GNU extension (but valgrind is better)
@@ -86,7 +86,7 @@ void Dump_Info(void)
     printf("    Cycles:  %ld\n", cast(unsigned long, Eval_Cycles));
     printf("    Counter: %d\n", cast(int, Eval_Count));
     printf("    Dose:    %d\n", cast(int, Eval_Dose));
-    printf("    Signals: %lx\n", cast(unsigned long, Eval_Signals));
+    printf("    Signals: %lx\n", cast(unsigned long, Load_Signals()));
     printf("    Sigmask: %lx\n", cast(unsigned long, Eval_Sigmask));
     printf("    DSP:     %ld\n", cast(unsigned long, DSP));
 
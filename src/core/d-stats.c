@@ -70,6 +70,12 @@ REBNATIVE(stats)
             "made-blocks:",
             "made-objects:",
             "recycles:",
+            "varlist-reuse-hits:",
+            "varlist-reuse-misses:",
+            "compose-cells-copied:",
+            "compose-cells-shared:",
+            "shape-cache-hits:",
+            "shape-cache-misses:",
                 "_",
         "]", rebEND);
 
@@ -101,6 +107,21 @@ REBNATIVE(stats)
 
             stats++;
             Init_Integer(stats, PG_Reb_Stats->Recycle_Counter);
+
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Varlist_Reuse_Hits);
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Varlist_Reuse_Misses);
+
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Compose_Cells_Copied);
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Compose_Cells_Shared);
+
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Shape_Cache_Hits);
+            stats++;
+            Init_Integer(stats, PG_Reb_Stats->Shape_Cache_Misses);
         }
 
         return D_OUT;
@@ -69,6 +69,36 @@ REBNATIVE(test_librebol)
     intptr_t getter = rebUnboxInteger("api-transient {Hello}", rebEND);
     Init_Logic(DS_PUSH(), rebDidQ("{Hello} =", cast(void*, getter), rebEND));
 
+    // rebHalt() only sets a bit, as it would from a signal handler, leaving
+    // the evaluator's countdown alone.  It must still be acted upon within
+    // one EVAL_DOSE of steps (give or take the few that CATCH itself takes).
+    //
+    Init_Integer(DS_PUSH(), 3);
+    REBI64 before = Eval_Cycles + Eval_Dose - Eval_Count;
+    rebHalt();
+    REBVAL *halted = rebQuoteInterruptible(
+        "null? catch/name [loop", rebI(2 * EVAL_DOSE), "[_] true] :halt",
+    rebEND);
+    REBI64 latency = Eval_Cycles + Eval_Dose - Eval_Count - before;
+    Init_Logic(
+        DS_PUSH(),
+        rebDid(halted, rebEND) and latency <= EVAL_DOSE + 10
+    );
+    rebRelease(halted);
+
+    // Asking for a signal to be polled early must not throw off the count
+    // of steps taken (which is what the Eval_Limit quota is enforced with).
+    //
+    Init_Integer(DS_PUSH(), 4);
+    before = Eval_Cycles + Eval_Dose - Eval_Count;
+    rebElide("loop 100 [_]", rebEND);
+    REBI64 unpolled = Eval_Cycles + Eval_Dose - Eval_Count - before;
+    before = Eval_Cycles + Eval_Dose - Eval_Count;
+    SET_SIGNAL_AND_POLL(SIG_RECYCLE);
+    rebElide("loop 100 [_]", rebEND);
+    REBI64 polled = Eval_Cycles + Eval_Dose - Eval_Count - before;
+    Init_Logic(DS_PUSH(), polled == unpolled);
+
     return Init_Block(D_OUT, Pop_Stack_Values(dsp_orig));
   #endif
 }
@@ -34,14 +34,257 @@
 // %c-eval.c, and the system could be compiled without it (or it could be
 // done as an extension).
 //
+// Because printing each step runs the evaluator several times per traced
+// step, it is thousands of times slower than the code being traced.  So
+// there is also TRACE/RECORD, which writes a fixed-size binary record per
+// event into a ring buffer.  That can be fetched with TRACE-DUMP (and a
+// debug build's panic writes it to %r3-trace.bin), then made readable
+// offline with %scripts/trace-decode.reb.
+//
 
 #include "sys-core.h"
 
+#include <time.h>  // clock(), for event timestamps
+
 enum {
-    TRACE_FLAG_FUNCTION = 1 << 0
+    TRACE_FLAG_FUNCTION = 1 << 0,
+    TRACE_FLAG_RECORD = 1 << 1
 };
 
 
+//=//// TRACE/RECORD EVENTS ///////////////////////////////////////////////=//
+//
+// Events are written in native byte order.  If this layout is changed, then
+// %scripts/trace-decode.reb must be changed to match.
+//
+
+enum {
+    TRACE_EVENT_STEP = 1,  // evaluator about to run the value at array/index
+    TRACE_EVENT_ENTER = 2,  // action dispatched (first phase only)
+    TRACE_EVENT_EXIT = 3  // action returned (no EXIT if it failed)
+};
+
+#define TRACE_DETAIL_NATIVE 0x01  // ENTER/EXIT: action is a native
+#define TRACE_DETAIL_THROWN 0x02  // EXIT: action threw
+
+#define TRACE_LABEL_SIZE 16
+#define TRACE_CLOCK_INTERVAL 64  // events per clock() call (it's a syscall)
+#define TRACE_RING_DEFAULT_SIZE 65536
+#define TRACE_RING_MAX_SIZE (1 << 24)  // 768MB of events
+
+struct Reb_Trace_Event {
+    uint64_t tick;  // evaluator tick in debug builds, else the event number
+    uint64_t usec;  // processor time from clock() in microseconds, sampled
+                    // every TRACE_CLOCK_INTERVAL events (use `tick` to order)
+    uint32_t frame;  // identifies the frame (low bits of its address)
+    uint32_t array;  // identifies the array (low bits of address), or 0
+    uint32_t index;  // STEP: position of the value in the array
+    uint16_t symbol;  // SYM_XXX of the label if it's a built-in word, else 0
+    uint8_t kind;  // TRACE_EVENT_XXX
+    uint8_t detail;  // STEP: kind byte of the value, else TRACE_DETAIL_XXX
+    char label[TRACE_LABEL_SIZE];  // spelling (truncated), NUL-padded
+};
+
+STATIC_ASSERT(sizeof(struct Reb_Trace_Event) == 48);
+
+
+inline static struct Reb_Trace_Event *Next_Trace_Event(
+    REBFRM *f,
+    uint8_t kind
+){
+    struct Reb_Trace_Event *e
+        = &Trace_Ring[Trace_Ring_Count & (Trace_Ring_Size - 1)];
+
+  #if defined(DEBUG_COUNT_TICKS)
+    e->tick = TG_Tick;
+  #else
+    e->tick = Trace_Ring_Count;
+  #endif
+    if ((Trace_Ring_Count & (TRACE_CLOCK_INTERVAL - 1)) == 0)
+        Trace_Usec = cast(uint64_t, clock()) * 1000000 / CLOCKS_PER_SEC;
+    ++Trace_Ring_Count;
+
+    e->usec = Trace_Usec;
+    e->frame = cast(uint32_t, cast(uintptr_t, f));
+    e->kind = kind;
+    return e;
+}
+
+
+static void Set_Trace_Label(struct Reb_Trace_Event *e, REBSTR *opt_spelling)
+{
+    size_t size = 0;
+    if (not opt_spelling)
+        e->symbol = 0;
+    else {
+        e->symbol = cast(uint16_t, STR_SYMBOL(opt_spelling));
+
+        const REBYTE *utf8 = cb_cast(STR_UTF8(opt_spelling));
+        size = STR_SIZE(opt_spelling);
+        if (size > TRACE_LABEL_SIZE) {  // don't cut a codepoint in half
+            size = TRACE_LABEL_SIZE;
+            while (size > 0 and (utf8[size] & 0xC0) == 0x80)
+                --size;
+        }
+        memcpy(e->label, utf8, size);
+    }
+    memset(e->label + size, 0, TRACE_LABEL_SIZE - size);
+}
+
+
+//
+//  Recording_Eval_Hook_Throws: C
+//
+// Eval hook for TRACE/RECORD.  Unlike Traced_Eval_Hook_Throws(), this does
+// not honor a depth limit (finding the depth means walking the stack).
+//
+bool Recording_Eval_Hook_Throws(REBFRM * const f)
+{
+    struct Reb_Trace_Event *e = Next_Trace_Event(f, TRACE_EVENT_STEP);
+
+    const RELVAL *v = f->feed->value;
+    if (FRM_IS_VALIST(f)) {
+        e->array = 0;
+        e->index = 0;
+    }
+    else {
+        e->array = cast(uint32_t, cast(uintptr_t, FRM_ARRAY(f)));
+        e->index = FRM_INDEX(f);
+    }
+    e->detail = KIND_BYTE(v);
+    Set_Trace_Label(e, ANY_WORD(v) ? VAL_WORD_SPELLING(v) : nullptr);
+
+    return Eval_Internal_Maybe_Stale_Throws(f);
+}
+
+
+//
+//  Recording_Dispatch_Hook: C
+//
+REB_R Recording_Dispatch_Hook(REBFRM * const f)
+{
+    REBACT *phase = FRM_PHASE(f);
+    uint8_t native = GET_ACTION_FLAG(phase, IS_NATIVE)
+        ? TRACE_DETAIL_NATIVE
+        : 0;
+
+    if (phase == f->original) {  // only the first phase counts as entering
+        struct Reb_Trace_Event *e = Next_Trace_Event(f, TRACE_EVENT_ENTER);
+        e->array = 0;
+        e->index = 0;
+        e->detail = native;
+        Set_Trace_Label(e, f->opt_label);
+    }
+
+    bool last_phase = (ACT_UNDERLYING(phase) == phase);  // see Traced_Dispatch
+
+    REB_R r = (*Trace_Saved_Dispatch)(f);  // e.g. METRICS' hook, if it was on
+
+    if (
+        r and r != f->out
+        and KIND_BYTE(r) == REB_R_REDO
+        and not EXTRA(Any, r).flag
+    ){
+        last_phase = false;
+    }
+
+    if (last_phase) {
+        struct Reb_Trace_Event *e = Next_Trace_Event(f, TRACE_EVENT_EXIT);
+        e->array = 0;
+        e->index = 0;
+        e->detail = native | (r == R_THROWN ? TRACE_DETAIL_THROWN : 0);
+        Set_Trace_Label(e, f->opt_label);
+    }
+
+    return r;
+}
+
+
+//
+//  Copy_Trace_Events: C
+//
+// Copy the recorded events, oldest first, to `dest` (which must have room
+// for Trace_Ring_Size events).  Returns how many were copied.
+//
+static REBLEN Copy_Trace_Events(REBYTE *dest)
+{
+    if (not Trace_Ring)
+        return 0;
+
+    REBLEN num = Trace_Ring_Count < Trace_Ring_Size
+        ? cast(REBLEN, Trace_Ring_Count)
+        : Trace_Ring_Size;
+    REBLEN oldest
+        = cast(REBLEN, Trace_Ring_Count - num) & (Trace_Ring_Size - 1);
+
+    REBLEN first = MIN(num, Trace_Ring_Size - oldest);  // up to end of ring
+    memcpy(
+        dest,
+        Trace_Ring + oldest,
+        first * sizeof(struct Reb_Trace_Event)
+    );
+    memcpy(
+        dest + first * sizeof(struct Reb_Trace_Event),
+        Trace_Ring,
+        (num - first) * sizeof(struct Reb_Trace_Event)
+    );
+    return num;
+}
+
+
+#if !defined(NDEBUG)
+
+//
+//  Dump_Trace_Ring_Debug: C
+//
+// Called on panic, so a TRACE/RECORD session shows the events leading up
+// to the crash.  (Release builds leave the ring in memory for core dumps.)
+//
+void Dump_Trace_Ring_Debug(void)
+{
+    if (not Trace_Ring or Trace_Ring_Count == 0)
+        return;
+
+    FILE *file = fopen("r3-trace.bin", "wb");
+    if (not file)
+        return;
+
+    // Avoid allocating while panicking, write oldest part of the ring first
+    //
+    REBLEN num = Trace_Ring_Count < Trace_Ring_Size
+        ? cast(REBLEN, Trace_Ring_Count)
+        : Trace_Ring_Size;
+    REBLEN oldest
+        = cast(REBLEN, Trace_Ring_Count - num) & (Trace_Ring_Size - 1);
+    REBLEN first = MIN(num, Trace_Ring_Size - oldest);
+
+    fwrite(Trace_Ring + oldest, sizeof(struct Reb_Trace_Event), first, file);
+    fwrite(Trace_Ring, sizeof(struct Reb_Trace_Event), num - first, file);
+    fclose(file);
+
+    printf("Last %lu TRACE/RECORD events written to r3-trace.bin\n",
+        cast(unsigned long, num)
+    );
+    fflush(stdout);
+}
+
+#endif
+
+
+//
+//  Shutdown_Trace: C
+//
+void Shutdown_Trace(void)
+{
+    if (Trace_Ring) {
+        FREE_N(struct Reb_Trace_Event, Trace_Ring_Size, Trace_Ring);
+        Trace_Ring = nullptr;
+    }
+    Trace_Ring_Size = 0;
+    Trace_Ring_Count = 0;
+}
+
+
 //
 //  Eval_Depth: C
 //
@@ -431,6 +674,11 @@ REB_R Traced_Dispatch_Hook(REBFRM * const f)
 //      mode [integer! logic!]
 //      /function
 //          "Traces functions only (less output)"
+//      /record
+//          "Record binary events for TRACE-DUMP instead of printing"
+//      /size
+//          "Events to keep when recording (default 65536, at most 2 ** 24)"
+//      [integer!]
 //  ]
 //
 REBNATIVE(trace)
@@ -454,7 +702,54 @@ REBNATIVE(trace)
     else
         Trace_Level = Int32(mode);
 
-    if (Trace_Level) {
+    // Take out the recording hook if it's in, putting back whatever hook it
+    // was put in over (e.g. METRICS' hook, or one the console saved).  Other
+    // hooks are left alone.
+    //
+    Trace_Flags = 0;
+    if (PG_Dispatch == &Recording_Dispatch_Hook)
+        PG_Dispatch = Trace_Saved_Dispatch;
+    else if (PG_Dispatch == &Traced_Dispatch_Hook)
+        PG_Dispatch = &Dispatch_Internal;
+
+    if (Trace_Level and REF(record)) {
+        REBLEN size = TRACE_RING_DEFAULT_SIZE;
+        if (REF(size)) {
+            size = Int32s(ARG(size), 1);
+            if (size > TRACE_RING_MAX_SIZE)
+                size = TRACE_RING_MAX_SIZE;
+            else if (size & (size - 1)) {  // round up to power of 2, for masking
+                REBLEN n = 1;
+                while (n < size)
+                    n <<= 1;
+                size = n;
+            }
+        }
+
+        // Keep the events of a previous recording if the size matches, so
+        // tracing can be switched on and off around the code of interest.
+        //
+        if (size != Trace_Ring_Size) {
+            Shutdown_Trace();
+            Trace_Ring = ALLOC_N(struct Reb_Trace_Event, size);
+            if (not Trace_Ring) {  // don't install hooks that would use it
+                Trace_Level = 0;
+                PG_Eval_Maybe_Stale_Throws = &Eval_Internal_Maybe_Stale_Throws;
+                fail (Error_No_Memory(
+                    cast(REBLEN, size * sizeof(struct Reb_Trace_Event))
+                ));
+            }
+            Trace_Ring_Size = size;
+        }
+
+        Trace_Usec = cast(uint64_t, clock()) * 1000000 / CLOCKS_PER_SEC;
+
+        Trace_Flags |= TRACE_FLAG_RECORD;
+        PG_Eval_Maybe_Stale_Throws = &Recording_Eval_Hook_Throws;
+        Trace_Saved_Dispatch = PG_Dispatch;
+        PG_Dispatch = &Recording_Dispatch_Hook;
+    }
+    else if (Trace_Level) {
         PG_Eval_Maybe_Stale_Throws = &Traced_Eval_Hook_Throws;
 
         if (REF(function))
@@ -466,3 +761,34 @@ REBNATIVE(trace)
 
     return nullptr;
 }
+
+
+//
+//  trace-dump: native [
+//
+//  {Get the events recorded by TRACE/RECORD, oldest first}
+//
+//      return: "Null if nothing recorded (see %scripts/trace-decode.reb)"
+//          [<opt> binary!]
+//      /clear
+//          "Discard the recorded events afterward"
+//  ]
+//
+REBNATIVE(trace_dump)
+{
+    INCLUDE_PARAMS_OF_TRACE_DUMP;
+
+    if (not Trace_Ring or Trace_Ring_Count == 0)
+        return nullptr;
+
+    REBBIN *bin = Make_Binary(
+        Trace_Ring_Size * sizeof(struct Reb_Trace_Event)
+    );
+    REBLEN num = Copy_Trace_Events(BIN_HEAD(bin));
+    TERM_BIN_LEN(bin, num * sizeof(struct Reb_Trace_Event));
+
+    if (REF(clear))
+        Trace_Ring_Count = 0;
+
+    return Init_Binary(D_OUT, bin);
+}
@@ -140,6 +140,9 @@ REBLEN Modify_Array(
         (dst_idx == ARR_LEN(dst_arr))
         and GET_ARRAY_FLAG(dst_arr, NEWLINE_AT_TAIL);
 
+    if (sym == SYM_CHANGE and dst_idx < tail)
+        Unhash_Array(dst_arr);  // overwrites items, see SERIES_INFO_HASHED
+
     if (sym != SYM_CHANGE) {
         // Always expand dst_arr for INSERT and APPEND actions:
         Expand_Series(SER(dst_arr), dst_idx, size);
@@ -270,6 +270,12 @@ diff_of_ends:
 }
 
 
+// Subtracting can overflow for INTEGER!s of opposite sign, so compare.
+//
+inline static REBINT Cmp_Int64(REBI64 a, REBI64 b)
+    { return (a > b) - (a < b); }
+
+
 //
 //  Cmp_Value: C
 //
@@ -279,6 +285,12 @@ diff_of_ends:
 //
 REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
 {
+    // KIND_BYTE() encodes quoting levels, so if both bytes are REB_INTEGER
+    // then neither value is quoted and the general dispatch can be skipped.
+    //
+    if (KIND_BYTE(sval) == REB_INTEGER and KIND_BYTE(tval) == REB_INTEGER)
+        return Cmp_Int64(VAL_INT64(sval), VAL_INT64(tval));
+
     if (is_case and (VAL_NUM_QUOTES(sval) != VAL_NUM_QUOTES(tval)))
         return VAL_NUM_QUOTES(sval) - VAL_NUM_QUOTES(tval);
 
@@ -310,7 +322,7 @@ REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
             d2 = VAL_DECIMAL(t);
             goto chkDecimal;
         }
-        return THE_SIGN(VAL_INT64(s) - VAL_INT64(t));
+        return Cmp_Int64(VAL_INT64(s), VAL_INT64(t));
 
       case REB_LOGIC:
         return VAL_LOGIC(s) - VAL_LOGIC(t);
@@ -442,6 +454,106 @@ REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
 }
 
 
+// The specialized comparators below are for when one side of the comparison
+// is known to be of a given type (e.g. the target of a FIND).  The other side
+// is checked, so they may be called on anything--if it isn't the same type
+// (and quoting level) they defer to Cmp_Value().
+
+static REBINT Cmp_Integer_Values(
+    const RELVAL *s,
+    const RELVAL *t,
+    bool is_case
+){
+    if (KIND_BYTE(s) != REB_INTEGER or KIND_BYTE(t) != REB_INTEGER)
+        return Cmp_Value(s, t, is_case);
+    return Cmp_Int64(VAL_INT64(s), VAL_INT64(t));
+}
+
+static REBINT Cmp_Decimal_Values(
+    const RELVAL *s,
+    const RELVAL *t,
+    bool is_case
+){
+    if (KIND_BYTE(s) != REB_DECIMAL or KIND_BYTE(t) != REB_DECIMAL)
+        return Cmp_Value(s, t, is_case);
+
+    REBDEC d1 = VAL_DECIMAL(s);
+    REBDEC d2 = VAL_DECIMAL(t);
+    if (Eq_Decimal(d1, d2))
+        return 0;
+    return d1 < d2 ? -1 : 1;
+}
+
+static REBINT Cmp_Char_Values(
+    const RELVAL *s,
+    const RELVAL *t,
+    bool is_case
+){
+    if (KIND_BYTE(s) != REB_CHAR or KIND_BYTE(t) != REB_CHAR)
+        return Cmp_Value(s, t, is_case);
+
+    REBUNI c1 = VAL_CHAR(s);
+    REBUNI c2 = VAL_CHAR(t);
+    if (not is_case) {
+        c1 = UP_CASE(c1);
+        c2 = UP_CASE(c2);
+    }
+    return (c1 > c2) - (c1 < c2);
+}
+
+static REBINT Cmp_Word_Values(
+    const RELVAL *s,
+    const RELVAL *t,
+    bool is_case
+){
+    if (KIND_BYTE(s) != KIND_BYTE(t) or not ANY_WORD_KIND(KIND_BYTE(s)))
+        return Cmp_Value(s, t, is_case);
+
+    // Interning means equal spellings are the same REBSTR*, and the same
+    // canon if case doesn't matter, so equality needs no byte comparison.
+    //
+    if (is_case) {
+        if (VAL_WORD_SPELLING(s) == VAL_WORD_SPELLING(t))
+            return 0;
+    }
+    else if (VAL_WORD_CANON(s) == VAL_WORD_CANON(t))
+        return 0;
+
+    return Compare_Word(VAL_UNESCAPED(s), VAL_UNESCAPED(t), is_case);
+}
+
+
+//
+//  Choose_Comparator: C
+//
+// Get a comparator that acts like Cmp_Value(), but is faster when one of the
+// values is of the same type as `exemplar`.  Choose once per operation (per
+// SORT, per FIND, per map lookup) and use it for all the comparisons.
+//
+CMP_VALUE_FUNC *Choose_Comparator(const RELVAL *exemplar)
+{
+    switch (KIND_BYTE(exemplar)) {  // quoted values get generic comparison
+      case REB_INTEGER:
+        return &Cmp_Integer_Values;
+
+      case REB_DECIMAL:
+        return &Cmp_Decimal_Values;
+
+      case REB_CHAR:
+        return &Cmp_Char_Values;
+
+      case REB_WORD:
+      case REB_SET_WORD:
+      case REB_GET_WORD:
+      case REB_SYM_WORD:
+        return &Cmp_Word_Values;
+
+      default:
+        return &Cmp_Value;
+    }
+}
+
+
 //
 //  Find_In_Array_Simple: C
 //
@@ -451,9 +563,10 @@ REBINT Cmp_Value(const RELVAL *sval, const RELVAL *tval, bool is_case)
 REBLEN Find_In_Array_Simple(REBARR *array, REBLEN index, const RELVAL *target)
 {
     RELVAL *value = ARR_HEAD(array);
+    CMP_VALUE_FUNC *cmp = Choose_Comparator(target);
 
     for (; index < ARR_LEN(array); index++) {
-        if (0 == Cmp_Value(value + index, target, false))
+        if (0 == cmp(value + index, target, false))
             return index;
     }
 
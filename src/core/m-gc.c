@@ -504,11 +504,16 @@ static void Mark_Root_Series(void)
                 // This came from Alloc_Value(); all references should be
                 // from the C stack, only this visit should be marking it.
                 //
+                // The owner may be an unmanaged varlist of a running
+                // action, see notes on REBFRM.num_api_handles.  But once
+                // that action is dropped, its varlist must be managed.
+                //
                 assert(not (s->header.bits & NODE_FLAG_MARKED));
                 assert(not IS_SER_DYNAMIC(s));
                 assert(
                     not LINK(s).owner
                     or (LINK(s).owner->header.bits & NODE_FLAG_MANAGED)
+                    or Is_Frame_On_Stack(CTX(LINK(s).owner))
                 );
 
                 if (not (s->header.bits & NODE_FLAG_MANAGED)) {
@@ -532,7 +537,7 @@ static void Mark_Root_Series(void)
                   #endif
                     panic (s);
                 }
-                else  // Note that Mark_Frame_Stack_Deep() will mark the owner
+                else  // Mark_Frame_Stack_Deep() will mark owner (if managed)
                     s->header.bits |= NODE_FLAG_MARKED;
 
                 // Note: Eval_Core() might target API cells, uses END
@@ -1115,17 +1120,25 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     //
     TERM_ARRAY_LEN(BUF_COLLECT, ARR_LEN(BUF_COLLECT));
 
-    // The TG_Reuse list consists of entries which could grow to arbitrary
-    // length, and which aren't being tracked anywhere.  Cull them during GC
-    // in case the stack at one point got very deep and isn't going to use
-    // them again, and the memory needs reclaiming.
+    // The TG_Reuse lists consist of entries which aren't being tracked
+    // anywhere.  Cull them during GC in case the stack at one point got very
+    // deep and isn't going to use them again, and the memory needs reclaiming.
     //
-    while (TG_Reuse) {
-        REBARR *varlist = TG_Reuse;
-        TG_Reuse = LINK(TG_Reuse).reuse;
-        GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_Series()
+    REBLEN size_class = 0;
+    for (; size_class < NUM_VARLIST_REUSE_CLASSES; ++size_class) {
+        while (TG_Reuse[size_class]) {
+            REBARR *varlist = TG_Reuse[size_class];
+            TG_Reuse[size_class] = LINK(varlist).reuse;
+            GC_Kill_Series(SER(varlist)); // no track for Free_Unmanaged_...
+        }
+        TG_Reuse_Depth[size_class] = 0;
     }
 
+    // The shape cache doesn't mark the keylists it holds (so it doesn't keep
+    // them alive), hence it has to forget them before they might be swept.
+    //
+    Clear_Shape_Cache();
+
     // MARKING PHASE: the "root set" from which we determine the liveness
     // (or deadness) of a series.  If we are shutting down, we do not mark
     // several categories of series...but we do need to run the root marking.
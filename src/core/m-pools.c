@@ -285,7 +285,7 @@ void Startup_Pools(REBINT scale)
     // organized to have some of the logic not in the pools file
 
   #if !defined(NDEBUG)
-    PG_Reb_Stats = ALLOC(REB_STATS);
+    PG_Reb_Stats = ALLOC_ZEROFILL(REB_STATS);
   #endif
 
     // Manually allocated series that GC is not responsible for (unless a
@@ -694,6 +694,9 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
 
     REBLEN used_old = SER_USED(s);
 
+    if (GET_SERIES_INFO(s, HASHED) and index < used_old)
+        Unhash_Array(ARR(s));  // tail growth is picked up by next FIND
+
     REBYTE wide = SER_WIDE(s);
 
     const bool was_dynamic = IS_SER_DYNAMIC(s);
@@ -793,6 +796,9 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     }
   #endif
 
+    if (Is_Over_Series_Budget(s, cast(REBU64, used_old + delta + 1) * wide))
+        fail (Error_Series_Too_Big(cast(REBU64, used_old + delta + 1) * wide));
+
     // Have we recently expanded the same series?
 
     REBLEN x = 1;
@@ -958,6 +964,9 @@ void Remake_Series(REBSER *s, REBLEN units, REBYTE wide, REBFLGS flags)
 
     bool preserve = did (flags & NODE_FLAG_NODE);
 
+    if (Is_Over_Series_Budget(s, cast(REBU64, units + 1) * wide))
+        fail (Error_Series_Too_Big(cast(REBU64, units + 1) * wide));
+
     REBLEN used_old = SER_USED(s);
     REBYTE wide_old = SER_WIDE(s);
 
@@ -1167,8 +1176,11 @@ void GC_Kill_Series(REBSER *s)
 
     Free_Node(SER_POOL, NOD(s));
 
-    if (GC_Ballast > 0)
-        CLR_SIGNAL(SIG_RECYCLE);  // Enough space that requested GC can cancel
+    // Enough space that requested GC can cancel (test first, as clearing is
+    // an atomic read-modify-write and most frees have nothing to cancel)
+    //
+    if (GC_Ballast > 0 and GET_SIGNAL(SIG_RECYCLE))
+        CLR_SIGNAL(SIG_RECYCLE);
 
   #if !defined(NDEBUG)
     PG_Reb_Stats->Series_Freed++;
@@ -207,6 +207,13 @@ void Remove_Series_Units(REBSER *s, REBSIZ offset, REBINT quantity)
     bool is_dynamic = IS_SER_DYNAMIC(s);
     REBLEN used_old = SER_USED(s);
 
+    if (GET_SERIES_INFO(s, HASHED)) {  // keep hash index of array in sync
+        if (offset + cast(REBLEN, quantity) >= used_old)
+            Unhash_Array_Tail(ARR(s), cast(REBLEN, offset));
+        else
+            Unhash_Array(ARR(s));
+    }
+
     REBLEN start = offset * SER_WIDE(s);
 
     // Optimized case of head removal.  For a dynamic series this may just
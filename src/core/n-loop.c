@@ -74,6 +74,97 @@ bool Catching_Break_Or_Continue(REBVAL *val, bool *broke)
 }
 
 
+// Once a loop body has run HOT_LOOP_THRESHOLD times, the loop is offered to
+// the ACTION! in `system/options/loop-hook` (if any).  That gives a tiered
+// executor such as the TCC extension's TRACE-LOOP a chance to run some of
+// the remaining iterations faster than the evaluator can.
+//
+#define HOT_LOOP_THRESHOLD 100
+#define HOT_LOOP_DECLINED ((REBLEN)(-1))
+
+
+//
+//  Try_Run_Hot_Loop: C
+//
+// The hook is called as:
+//
+//     hook condition body limit word
+//
+// CONDITION is WHILE's condition block (or BLANK!), LIMIT is how many more
+// times LOOP may run the body, or the end value for the counter WORD of a
+// REPEAT.  The hook returns null if it won't handle the loop, or `[n last]`
+// if it ran N iterations whose last body result was LAST.  It must leave the
+// variables the way the evaluator would have left them, so the loop can just
+// pick up where it left off.
+//
+// Returns how many iterations the hook ran.  After a hook has run some, the
+// next iteration is done by the evaluator (e.g. to raise an error the hook
+// didn't want to) and then the hook is asked again.
+//
+static REBI64 Try_Run_Hot_Loop(
+    REBLEN *hot,
+    REBVAL *out,  // receives last body result if any iterations were run
+    const REBVAL *condition,  // nullptr if not WHILE
+    const REBVAL *body,
+    REBI64 limit,  // ignored for WHILE
+    const REBVAL *word  // REPEAT's counter, nullptr otherwise
+){
+    if (*hot == HOT_LOOP_DECLINED or ++*hot < HOT_LOOP_THRESHOLD)
+        return 0;
+
+    REBVAL *hook = Get_System(SYS_OPTIONS, OPTIONS_LOOP_HOOK);
+    if (
+        not IS_ACTION(hook)
+        or not IS_BLOCK(body)
+        or (condition and not IS_BLOCK(condition))
+    ){
+        *hot = HOT_LOOP_DECLINED;
+        return 0;
+    }
+
+    REBVAL *result = rebValue(
+        hook,
+        rebQ(condition ? condition : BLANK_VALUE, rebEND),
+        rebQ(body, rebEND),
+        condition ? BLANK_VALUE : rebI(limit),
+        rebQ(word ? word : BLANK_VALUE, rebEND),
+    rebEND);
+
+    if (not result) {
+        *hot = HOT_LOOP_DECLINED;
+        return 0;
+    }
+
+    if (
+        not IS_BLOCK(result)
+        or VAL_LEN_AT(result) != 2
+        or not IS_INTEGER(VAL_ARRAY_AT(result))
+        or VAL_INT64(VAL_ARRAY_AT(result)) < 0
+    ){
+        rebRelease(result);
+        fail ("LOOP-HOOK must return null or [iterations last-result]");
+    }
+
+    RELVAL *item = VAL_ARRAY_AT(result);
+    REBI64 ran = VAL_INT64(item);
+    if (not condition and not word and ran > limit) {
+        rebRelease(result);
+        fail ("LOOP-HOOK ran more iterations than LOOP had left");
+    }
+    if (ran != 0) {
+        Derelativize(out, item + 1, VAL_SPECIFIER(result));
+        Voidify_If_Nulled_Or_Blank(out);  // as the loops do, null means BREAK
+    }
+    rebRelease(result);
+
+    // If the hook ran nothing (e.g. it stopped to let the evaluator raise an
+    // error, or a variable's type changed), wait before asking it again.
+    //
+    *hot = (ran == 0) ? 0 : HOT_LOOP_THRESHOLD - 1;
+    return ran;
+}
+
+
 //
 //  break: native [
 //
@@ -210,7 +301,8 @@ static REB_R Loop_Integer_Common(
     const REBVAL *body,
     REBI64 start,
     REBI64 end,
-    REBI64 bump
+    REBI64 bump,
+    const REBVAL *word  // bound to var, if the loop can be offered as hot
 ){
     Init_Blank(out);  // result if body never runs
 
@@ -243,7 +335,20 @@ static REB_R Loop_Integer_Common(
     if ((counting_up and bump <= 0) or (not counting_up and bump >= 0))
         return nullptr;  // avoid infinite loops
 
+    REBLEN hot = 0;  // see Try_Run_Hot_Loop()
+
     while (counting_up ? *state <= end : *state >= end) {
+        if (
+            word
+            and bump == 1
+            and Try_Run_Hot_Loop(&hot, out, nullptr, body, end, word) != 0
+        ){
+            if (not IS_INTEGER(var))
+                fail (Error_Invalid_Type(VAL_TYPE(var)));
+            if (*state > end)  // hook left var at next value to run body for
+                break;
+        }
+
         if (Do_Branch_Throws(out, nullptr, body)) {
             bool broke;
             if (not Catching_Break_Or_Continue(out, &broke))
@@ -816,7 +921,8 @@ REBNATIVE(for)
             IS_DECIMAL(ARG(end))
                 ? cast(REBI64, VAL_DECIMAL(ARG(end)))
                 : VAL_INT64(ARG(end)),
-            VAL_INT64(ARG(bump))
+            VAL_INT64(ARG(bump)),
+            nullptr  // start and end are arbitrary, not offered as hot loop
         );
     }
 
@@ -1138,6 +1244,7 @@ static inline REBLEN Finalize_Remove_Each(struct Remove_Each_State *res)
                 ++count;
             }
             if (IS_END(src)) {
+                Unhash_Array(VAL_ARRAY(res->data));
                 TERM_ARRAY_LEN(VAL_ARRAY(res->data), len);
                 return count;
             }
@@ -1544,7 +1651,15 @@ REBNATIVE(loop)
     else
         count = Int64(ARG(count));
 
+    REBLEN hot = 0;  // see Try_Run_Hot_Loop()
+
     for (; count > 0; count--) {
+        count -= Try_Run_Hot_Loop(
+            &hot, D_OUT, nullptr, ARG(body), count, nullptr
+        );
+        if (count <= 0)
+            break;
+
         if (Do_Branch_Throws(D_OUT, nullptr, ARG(body))) {
             bool broke;
             if (not Catching_Break_Or_Continue(D_OUT, &broke))
@@ -1606,8 +1721,16 @@ REBNATIVE(repeat)
     if (n < 1)  // Loop_Integer from 1 to 0 with bump of 1 is infinite
         return Init_Blank(D_OUT);  // blank if loop condition never runs
 
+    Init_Any_Word_Bound(  // for Try_Run_Hot_Loop() to get and set
+        D_SPARE,
+        REB_WORD,
+        CTX_KEY_SPELLING(context, 1),
+        context,
+        1
+    );
+
     return Loop_Integer_Common(
-        D_OUT, var, ARG(body), 1, VAL_INT64(value), 1
+        D_OUT, var, ARG(body), 1, VAL_INT64(value), 1, D_SPARE
     );
 }
 
@@ -1667,7 +1790,13 @@ REBNATIVE(while)
 
     Init_Blank(D_OUT); // result if body never runs
 
+    REBLEN hot = 0;  // see Try_Run_Hot_Loop()
+
     do {
+        Try_Run_Hot_Loop(
+            &hot, D_OUT, ARG(condition), ARG(body), 0, nullptr
+        );  // condition is run again below, so result doesn't matter
+
         if (Do_Branch_Throws(D_SPARE, nullptr, ARG(condition))) {
             Move_Value(D_OUT, D_SPARE);
             return R_THROWN;  // don't see BREAK/CONTINUE in the *condition*
@@ -462,6 +462,17 @@ REBINT CT_Unhooked(const REBCEL *a, const REBCEL *b, REBINT mode)
 //
 REBINT Compare_Modify_Values(RELVAL *a, RELVAL *b, REBINT strictness)
 {
+    // Unquoted INTEGER!s are by far the most common comparison, so answer it
+    // without the quote normalization and compare hook dispatch below.
+    //
+    if (KIND_BYTE(a) == REB_INTEGER and KIND_BYTE(b) == REB_INTEGER) {
+        if (strictness >= 0)
+            return VAL_INT64(a) == VAL_INT64(b);
+        if (strictness == -1)
+            return VAL_INT64(a) >= VAL_INT64(b);
+        return VAL_INT64(a) > VAL_INT64(b);
+    }
+
     // !!! `(first ['a]) = (first [a])` was true in historical Rebol, due
     // the rules of "lax equality".  These rules are up in the air as they
     // pertain to the IS and ISN'T transition.  But to avoid having to
@@ -606,3 +606,138 @@ REBNATIVE(lock)
 
     return D_OUT;
 }
+
+
+struct Dedupe_State {
+    REBMAP *seen;  // locked string or binary => itself, cased comparison
+    REBSER *dropped;  // series no longer referenced from the value walked
+    REBI64 bytes_saved;
+};
+
+static void Dedupe_Array(struct Dedupe_State *d, REBARR *a);
+
+static void Dedupe_Cell(struct Dedupe_State *d, RELVAL *v)
+{
+    enum Reb_Kind kind = VAL_TYPE(v);  // REB_QUOTED skipped, as in Uncolor()
+
+    if (ANY_ARRAY_OR_PATH_KIND(kind)) {
+        Dedupe_Array(d, VAL_ARRAY(v));
+        return;
+    }
+    if (kind == REB_MAP) {
+        Dedupe_Array(d, MAP_PAIRLIST(VAL_MAP(v)));
+        return;
+    }
+    if (ANY_CONTEXT_KIND(kind) and kind != REB_FRAME) {
+        Dedupe_Array(d, CTX_VARLIST(VAL_CONTEXT(v)));
+        return;
+    }
+
+    if (not ANY_STRING_KIND(kind) and kind != REB_BINARY)
+        return;
+
+    // Only whole series are shared.  They must be locked, since otherwise a
+    // change through one reference would show up through the others.
+    //
+    if (VAL_INDEX(v) != 0)
+        return;
+
+    REBSER *s = VAL_SERIES(v);
+    if (not Is_Series_Frozen(s))
+        return;
+
+    const bool cased = true;
+    REBLEN n = Find_Map_Entry(d->seen, v, SPECIFIED, nullptr, nullptr, cased);
+    if (n == 0) {
+        Find_Map_Entry(d->seen, v, SPECIFIED, v, SPECIFIED, cased);
+        return;
+    }
+
+    REBSER *keep = VAL_SERIES(ARR_AT(MAP_PAIRLIST(d->seen), (n - 1) * 2));
+    if (keep == s)
+        return;
+
+    if (not Is_Series_Black(s)) {  // first reference seen, count it once
+        Flip_Series_To_Black(s);
+        Push_Pointer_To_Series(d->dropped, s);
+        d->bytes_saved += sizeof(REBSER) + SER_TOTAL_IF_DYNAMIC(s);
+    }
+
+    INIT_VAL_NODE(v, keep);  // keeps index (0), and NEWLINE_BEFORE, etc.
+}
+
+static void Dedupe_Array(struct Dedupe_State *d, REBARR *a)
+{
+    if (Is_Series_Black(SER(a)))
+        return;  // already visited (or cyclic)
+
+    Flip_Series_To_Black(SER(a));
+
+    RELVAL *v = ARR_HEAD(a);
+    for (; NOT_END(v); ++v)
+        Dedupe_Cell(d, v);
+}
+
+//
+//  dedupe: native [
+//
+//  {Make equal locked strings and binaries in a value share one series}
+//
+//      return: "Bytes in series no longer referenced by the value"
+//          [integer!]
+//      value "Searched deeply, through blocks, maps and objects"
+//          [any-array! any-path! map! any-context!]
+//  ]
+//
+REBNATIVE(dedupe)
+//
+// Data loaded from files tends to have many equal strings (e.g. category
+// names or hostnames), each in its own series.  If the data is LOCK'd, the
+// duplicates can share one series with no visible difference (except to
+// SAME?).  The series dropped will be freed by the GC if nothing else uses
+// them, so the bytes reported are an upper bound of what will be reclaimed.
+//
+// !!! Cells are updated in place, even inside locked arrays.  This doesn't
+// change what they hold, only which of several identical series holds it.
+{
+    INCLUDE_PARAMS_OF_DEDUPE;
+
+    struct Dedupe_State state;
+    state.seen = Make_Map(64);  // made before the trap, so not freed by it
+    state.dropped = Make_Series(64, sizeof(REBSER*));
+    state.bytes_saved = 0;
+
+    // Adding to the map can fail (e.g. under BUDGET/SERIES), and the arrays
+    // and dropped series colored black must be made white again either way.
+    //
+    struct Reb_State trap_state;
+    REBCTX *error;
+
+    PUSH_TRAP(&error, &trap_state);
+
+    // The first time through the following code 'error' will be null, but...
+    // `fail` can longjmp here, so 'error' won't be null *if* that happens!
+    //
+    if (not error) {
+        Dedupe_Cell(&state, ARG(value));
+        DROP_TRAP_SAME_STACKLEVEL_AS_PUSH(&trap_state);
+    }
+
+    // The dropped series go white first, as a walk that failed partway may
+    // have left cells still referring to them (which Uncolor() checks).
+    //
+    REBLEN i;
+    for (i = 0; i < SER_LEN(state.dropped); ++i)
+        Flip_Series_To_White(*SER_AT(REBSER*, state.dropped, i));
+    Free_Unmanaged_Series(state.dropped);
+
+    Uncolor(ARG(value));
+
+    Free_Unmanaged_Series(MAP_HASHLIST(state.seen));
+    Free_Unmanaged_Array(MAP_PAIRLIST(state.seen));
+
+    if (error)
+        fail (error);
+
+    return Init_Integer(D_OUT, state.bytes_saved);
+}
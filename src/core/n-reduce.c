@@ -143,6 +143,50 @@ bool Match_For_Compose(const RELVAL *group, const REBVAL *label) {
 }
 
 
+static bool Array_Has_Groups_Deep(REBARR *a);
+
+static bool Has_Groups_Deep(const RELVAL *item)
+{
+    for (; NOT_END(item); ++item) {
+        const REBCEL *cell = VAL_UNESCAPED(item);
+        enum Reb_Kind kind = CELL_KIND(cell);
+        if (ANY_GROUP_KIND(kind))
+            return true;
+        if (
+            ANY_ARRAY_OR_PATH_KIND(kind)
+            and Array_Has_Groups_Deep(VAL_ARRAY(cell))
+        ){
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Whether COMPOSE/DEEP would have any reason to walk into an array.  Groups
+// are counted whether they match the label or not, since non-matching ones
+// can have matching ones inside.  The answer is cached on frozen arrays
+// (for the whole array, not just from the index), so composing LOCK'd
+// templates doesn't need to look at the unchanging parts again.
+//
+// An array that isn't frozen is just walked (so this says it may have
+// groups).  Scanning it first would only pay off once, and each level of a
+// nested template would rescan everything under it before walking into it.
+//
+static bool Array_Has_Groups_Deep(REBARR *a)
+{
+    if (not Is_Array_Deeply_Frozen(a))
+        return true;
+
+    if (NOT_ARRAY_FLAG(a, COMPOSE_SCANNED)) {
+        if (Has_Groups_Deep(ARR_HEAD(a)))
+            SET_ARRAY_FLAG(a, COMPOSE_HAS_GROUPS);
+        SET_ARRAY_FLAG(a, COMPOSE_SCANNED);
+    }
+    return GET_ARRAY_FLAG(a, COMPOSE_HAS_GROUPS);
+}
+
+
 //
 //  Compose_To_Stack_Core: C
 //
@@ -329,6 +373,17 @@ REB_R Compose_To_Stack_Core(
         else if (deep) {
             // compose/deep [does [(1 + 2)] nested] => [does [3] nested]
 
+            if (not Array_Has_Groups_Deep(VAL_ARRAY(cell))) {
+                //
+                // Nothing to substitute under it, so don't walk it at all.
+                //
+                Derelativize(DS_PUSH(), *v, specifier);
+              #if !defined(NDEBUG)
+                PG_Reb_Stats->Compose_Cells_Shared += VAL_LEN_AT(cell);
+              #endif
+                continue;
+            }
+
             REBDSP dsp_deep = DSP;
             REB_R r = Compose_To_Stack_Core(
                 out,
@@ -354,6 +409,9 @@ REB_R Compose_To_Stack_Core(
                 //
                 DS_DROP_TO(dsp_deep);
                 Derelativize(DS_PUSH(), *v, specifier);
+              #if !defined(NDEBUG)
+                PG_Reb_Stats->Compose_Cells_Shared += VAL_LEN_AT(cell);
+              #endif
                 continue;
             }
 
@@ -362,6 +420,9 @@ REB_R Compose_To_Stack_Core(
                 pop_flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
 
             REBARR *popped = Pop_Stack_Values_Core(dsp_deep, pop_flags);
+          #if !defined(NDEBUG)
+            PG_Reb_Stats->Compose_Cells_Copied += ARR_LEN(popped);
+          #endif
             if (ANY_PATH_KIND(kind))
                 Init_Any_Path(
                     DS_PUSH(),
@@ -470,6 +531,9 @@ REBNATIVE(compose)
         flags |= ARRAY_FLAG_NEWLINE_AT_TAIL;
 
     REBARR *popped = Pop_Stack_Values_Core(dsp_orig, flags);
+  #if !defined(NDEBUG)
+    PG_Reb_Stats->Compose_Cells_Copied += ARR_LEN(popped);
+  #endif
     if (ANY_PATH(ARG(value)))
         return Init_Any_Path(D_OUT, VAL_TYPE(ARG(value)), popped);
 
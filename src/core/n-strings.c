@@ -75,6 +75,8 @@ REBNATIVE(delimit)
 //          [any-value!]
 //      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
 //          [word!]
+//      /level "0 (just store) to 9 (smallest but slowest), default is 6"
+//          [integer!]
 //  ]
 //
 REBNATIVE(deflate)
@@ -101,12 +103,20 @@ REBNATIVE(deflate)
         }
     }
 
+    REBINT level = -1;  // zlib's default (currently the same as 6)
+    if (REF(level)) {
+        level = VAL_INT32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PAR(level));
+    }
+
     size_t compressed_size;
     void *compressed = Compress_Alloc_Core(
         &compressed_size,
         bp,
         size,
-        envelope
+        envelope,
+        level
     );
 
     return rebRepossess(compressed, compressed_size);
@@ -69,6 +69,10 @@
 //   mold...and copy out a series of the precise width and length needed.
 //   (That is, if copying out the result is needed at all.)
 //
+// * When a large mold is the only one in progress, the copy is avoided by
+//   handing the buffer's allocation over to the result series, and giving
+//   the mold buffer a fresh small allocation instead.  See Pop_Molded_String()
+//
 
 #include "sys-core.h"
 
@@ -470,6 +474,62 @@ REBSTR *Copy_Mold_Or_Form_Value(const RELVAL *v, REBFLGS opts, bool form)
 }
 
 
+// Guesses for how many bytes forming an evaluated item will take, used to
+// reserve mold buffer space.  Overestimating is cheap (the space is reused
+// by later molds) but underestimating makes the buffer expand mid-mold.
+//
+#define FORM_GUESS_EVALUATED 16  // e.g. a WORD! fetching a variable
+#define FORM_GUESS_NUMBER 24
+
+
+//
+//  Estimate_Form_Reduce_Size: C
+//
+// Single pass over a block that will be reduced and formed, summing sizes of
+// items whose size is known (strings) or can be guessed from their type.
+// Items that take arguments aren't accounted for--it's only an estimate.
+//
+static REBLEN Estimate_Form_Reduce_Size(
+    const RELVAL *item,
+    REBLEN delimiter_size
+){
+    REBLEN size = 0;
+    for (; NOT_END(item); ++item) {
+        switch (KIND_BYTE(item)) {
+          case REB_TEXT:
+          case REB_FILE:
+          case REB_EMAIL:
+          case REB_URL:
+          case REB_TAG:
+          case REB_ISSUE:
+            size += STR_SIZE(VAL_STRING(item));  // from head: overestimate
+            break;
+
+          case REB_CHAR:
+            size += 4;  // largest UTF-8 encoding
+            break;
+
+          case REB_INTEGER:
+          case REB_DECIMAL:
+          case REB_PERCENT:
+          case REB_MONEY:
+            size += FORM_GUESS_NUMBER;
+            break;
+
+          case REB_BLANK:
+            size += 1;
+            break;
+
+          default:
+            size += FORM_GUESS_EVALUATED;
+            break;
+        }
+        size += delimiter_size;
+    }
+    return size;
+}
+
+
 //
 //  Form_Reduce_Throws: C
 //
@@ -505,7 +565,23 @@ bool Form_Reduce_Throws(
     if (IS_BLANK(delimiter))
         delimiter = SPACE_VALUE;
 
+    REBLEN delimiter_size;
+    if (IS_TEXT(delimiter))
+        delimiter_size = VAL_SIZE_AT(delimiter);
+    else if (IS_CHAR(delimiter))
+        delimiter_size = 4;
+    else
+        delimiter_size = 0;
+
+    // Reserve the space the result is expected to need all at once, instead
+    // of expanding the mold buffer repeatedly as items are formed.
+    //
     DECLARE_MOLD (mo);
+    SET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE);
+    mo->reserve = Estimate_Form_Reduce_Size(
+        ARR_AT(array, index),
+        delimiter_size
+    );
     Push_Mold(mo);
 
     DECLARE_ARRAY_FEED (feed, array, index, specifier);
@@ -587,12 +663,14 @@ void Push_Mold(REB_MOLD *mo)
     mo->offset = STR_SIZE(mo->series);
     mo->index = STR_LEN(mo->series);
 
+    ++TG_Mold_Depth;
+
     if (GET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT))
         assert(mo->limit != 0);  // !!! Should a limit of 0 be allowed?
 
     if (
         GET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE)
-        and SER_REST(s) < mo->reserve
+        and SER_REST(s) - SER_USED(s) <= mo->reserve  // need terminator too
     ){
         // Expand will add to the series length, so we set it back.
         //
@@ -707,6 +785,32 @@ REBSTR *Pop_Molded_String(REB_MOLD *mo)
     REBSIZ size = STR_SIZE(mo->series) - mo->offset;
     REBLEN len = STR_LEN(mo->series) - mo->index;
 
+    --TG_Mold_Depth;
+
+    // If no other mold has data in the buffer (or is pushed, and so would be
+    // holding onto the buffer) then a big result can just take the buffer's
+    // allocation.  That saves a copy, but the buffer will have to grow again
+    // on the next big mold--so only do it if most of the allocation is used.
+    //
+    if (
+        TG_Mold_Depth == 0
+        and mo->offset == 0
+        and size >= MOLD_HANDOVER_MIN_SIZE
+        and size >= SER_REST(SER(mo->series)) / 2
+    ){
+        REBSTR *popped = Make_String_Core(
+            MIN_COMMON,
+            SERIES_FLAG_ALWAYS_DYNAMIC
+        );
+        Free_Bookmarks_Maybe_Null(mo->series);  // LINK() is swapped too
+        Swap_Series_Content(SER(popped), SER(mo->series));
+        TERM_STR_LEN_SIZE(popped, len, size);
+        TERM_STR_LEN_SIZE(STR(mo->series), 0, 0);
+
+        mo->series = nullptr;  // indicates mold is not currently pushed
+        return popped;
+    }
+
     REBSTR *popped = Make_String(size);
     memcpy(BIN_HEAD(SER(popped)), BIN_AT(SER(mo->series), mo->offset), size);
     TERM_STR_LEN_SIZE(popped, len, size);
@@ -737,6 +841,8 @@ REBSER *Pop_Molded_Binary(REB_MOLD *mo)
     ASSERT_SERIES_TERM(SER(mo->series));
     Throttle_Mold(mo);
 
+    --TG_Mold_Depth;
+
     REBSIZ size = STR_SIZE(mo->series) - mo->offset;
     REBSER *bin = Make_Binary(size);
     memcpy(BIN_HEAD(bin), BIN_AT(SER(mo->series), mo->offset), size);
@@ -786,6 +892,7 @@ void Drop_Mold_Core(
     //
     TERM_STR_LEN_SIZE(mo->series, mo->index, mo->offset);
 
+    --TG_Mold_Depth;
     mo->series = nullptr;  // indicates mold is not currently pushed
 }
 
@@ -805,6 +912,7 @@ void Startup_Mold(REBLEN size)
     // !!! Review, seems like the mold buffer logic is broken.  :-/
     //
     TG_Mold_Buf = Make_String_Core(size, SERIES_FLAG_ALWAYS_DYNAMIC);
+    TG_Mold_Depth = 0;
 }
 
 
@@ -420,9 +420,11 @@ REBLEN Find_In_Array(
 
     // All other cases
 
+    CMP_VALUE_FUNC *cmp = Choose_Comparator(target);
+
     for (; index >= start and index < end; index += skip) {
         RELVAL *item = ARR_AT(array, index);
-        if (0 == Cmp_Value(item, target, did (flags & AM_FIND_CASE)))
+        if (0 == cmp(item, target, did (flags & AM_FIND_CASE)))
             return index;
 
         if (flags & AM_FIND_MATCH)
@@ -433,11 +435,319 @@ REBLEN Find_In_Array(
 }
 
 
+//=//// HASH INDEX FOR ARRAYS /////////////////////////////////////////////=//
+//
+// A hashed array keeps a hashlist of 1-based item indices in its ->link (see
+// SERIES_INFO_HASHED).  Only the first item of each "class" is put in it,
+// where items are in the same class if they are the same word (ignoring case
+// and word type), or the same number, character, logic or blank.  Classes
+// are such that an uncased FIND matches either all of a class or none of it,
+// so blocks with lots of duplicates don't make for long probe sequences.
+//
+// The MISC() of the hashlist is how many items at the head of the array have
+// been indexed, and its LINK() is how many slots are used (with tombstones).
+//
+
+#define HASHED_ARRAY_TOMBSTONE \
+    cast(REBLEN, -1)  // slot of an item removed from the tail
+
+// Any DECIMAL! or PERCENT! equal to an INTEGER! (within the tolerance of
+// Eq_Decimal()) rounds to that integer, so long as the numbers are small
+// enough for the tolerance to be well under 0.5.  So numbers are hashed by
+// their nearest integer, and all numbers bigger than that share one hash.
+//
+#define HASHED_NUMBER_LIMIT \
+    (cast(REBI64, 1) << 46)
+
+static uint32_t Hash_Whole_Number(REBI64 i)
+{
+    if (i >= HASHED_NUMBER_LIMIT or i <= -HASHED_NUMBER_LIMIT)
+        i = HASHED_NUMBER_LIMIT;
+
+    REBU64 u = cast(REBU64, i);  // mix, so the bits used for slots vary
+    u ^= u >> 33;
+    u *= 0xff51afd7ed558ccdULL;
+    u ^= u >> 33;
+    return cast(uint32_t, u);
+}
+
+
+// Gives false for the types that are never indexed, because none of the
+// targets the index is used for could match them.
+//
+static bool Did_Hash_Array_Item(uint32_t *hash, const RELVAL *v)
+{
+    if (ANY_WORD(v)) {  // quoted words never match WORD! targets
+        *hash = Hash_String(VAL_WORD_SPELLING(v));  // case-insensitive
+        return true;
+    }
+
+    const REBCEL *cell = VAL_UNESCAPED(v);  // uncased compares ignore quotes
+    switch (CELL_KIND(cell)) {
+      case REB_INTEGER:
+        *hash = Hash_Whole_Number(VAL_INT64(cell));
+        return true;
+
+      case REB_DECIMAL:
+      case REB_PERCENT: {
+        REBDEC d = VAL_DECIMAL(cell);
+        if (d > -2.0 * HASHED_NUMBER_LIMIT and d < 2.0 * HASHED_NUMBER_LIMIT)
+            *hash = Hash_Whole_Number(cast(REBI64, floor(d + 0.5)));
+        else  // includes NaN and infinities
+            *hash = Hash_Whole_Number(HASHED_NUMBER_LIMIT);
+        return true; }
+
+      case REB_CHAR:
+        *hash = UP_CASE(VAL_CHAR(cell)) ^ 0x43484152;
+        return true;
+
+      case REB_LOGIC:
+        *hash = VAL_LOGIC(cell) ? 0x4C4F4731 : 0x4C4F4730;
+        return true;
+
+      case REB_BLANK:
+        *hash = 0x424C4E4B;
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+static bool Same_Hash_Class(const RELVAL *a, const RELVAL *b)
+{
+    if (ANY_WORD(a) or ANY_WORD(b))
+        return ANY_WORD(a) and ANY_WORD(b)
+            and VAL_WORD_CANON(a) == VAL_WORD_CANON(b);
+
+    const REBCEL *a_cell = VAL_UNESCAPED(a);
+    const REBCEL *b_cell = VAL_UNESCAPED(b);
+    if (CELL_KIND(a_cell) != CELL_KIND(b_cell))
+        return false;
+
+    switch (CELL_KIND(a_cell)) {
+      case REB_INTEGER:
+        return VAL_INT64(a_cell) == VAL_INT64(b_cell);
+
+      case REB_DECIMAL:
+      case REB_PERCENT:
+        return VAL_DECIMAL(a_cell) == VAL_DECIMAL(b_cell);
+
+      case REB_CHAR:
+        return UP_CASE(VAL_CHAR(a_cell)) == UP_CASE(VAL_CHAR(b_cell));
+
+      case REB_LOGIC:
+        return VAL_LOGIC(a_cell) == VAL_LOGIC(b_cell);
+
+      case REB_BLANK:
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+static void Hash_Array_Item(REBSER *hashlist, REBARR *a, REBLEN n)
+{
+    const RELVAL *item = ARR_AT(a, n);
+
+    uint32_t hash;
+    if (not Did_Hash_Array_Item(&hash, item))
+        return;
+
+    REBLEN *indices = SER_HEAD(REBLEN, hashlist);
+    REBLEN num_slots = SER_LEN(hashlist);
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+
+    REBLEN *tombstone = nullptr;
+    for (; indices[slot] != 0; slot = (slot + skip) % num_slots) {
+        if (indices[slot] == HASHED_ARRAY_TOMBSTONE) {
+            if (not tombstone)
+                tombstone = &indices[slot];
+        }
+        else if (Same_Hash_Class(ARR_AT(a, indices[slot] - 1), item))
+            return;  // only the first item of a class is indexed
+    }
+
+    if (tombstone)
+        *tombstone = n + 1;
+    else {
+        indices[slot] = n + 1;
+        ++LINK(hashlist).custom.u;
+    }
+}
+
+
+static REBSER *Rehash_Array(REBARR *a)
+{
+    REBLEN len = ARR_LEN(a);
+    REBSER *hashlist = Make_Hash_Sequence(2 * (len < 4 ? 4 : len));  // room
+    MISC(hashlist).length = len;
+    LINK(hashlist).custom.u = 0;
+    Manage_Series(hashlist);
+    LINK(a).custom.node = NOD(hashlist);
+
+    REBLEN n;
+    for (n = 0; n < len; ++n)
+        Hash_Array_Item(hashlist, a, n);
+
+    return hashlist;
+}
+
+
+// Bring the hashlist up to date with the array before using it.  Items that
+// were appended since the last search are added, unless the table would be
+// over half full...then it's rebuilt bigger (as it is if it was unhashed).
+//
+static REBSER *Update_Array_Hashlist(REBARR *a)
+{
+    assert(GET_SERIES_INFO(a, HASHED));
+
+    REBSER *hashlist = LINK_HASHLIST(a);
+    REBLEN len = ARR_LEN(a);
+    REBLEN n = MISC(hashlist).length;
+
+    if (
+        n == 0
+        or n > len  // shrunk without Unhash_Array_Tail(), be safe
+        or 2 * (LINK(hashlist).custom.u + len - n) > SER_LEN(hashlist)
+    ){
+        return Rehash_Array(a);
+    }
+
+    for (; n < len; ++n)
+        Hash_Array_Item(hashlist, a, n);
+
+    MISC(hashlist).length = len;
+    return hashlist;
+}
+
+
+//
+//  Unhash_Array_Tail: C
+//
+// Must be called before items from `index` to the tail of an array are
+// removed.  If it is hashed, those items are taken out of its index...unless
+// that's more than are being kept, in which case rehashing is cheaper.
+//
+void Unhash_Array_Tail(REBARR *a, REBLEN index)
+{
+    if (NOT_SERIES_INFO(a, HASHED))
+        return;
+
+    REBSER *hashlist = LINK_HASHLIST(a);
+    REBLEN num_hashed = MISC(hashlist).length;
+    if (num_hashed <= index)
+        return;  // the removed items weren't indexed yet
+
+    if (num_hashed > ARR_LEN(a) or num_hashed - index > index) {
+        MISC(hashlist).length = 0;
+        return;
+    }
+
+    REBLEN *indices = SER_HEAD(REBLEN, hashlist);
+    REBLEN num_slots = SER_LEN(hashlist);
+
+    REBLEN n;
+    for (n = index; n < num_hashed; ++n) {
+        uint32_t hash;
+        if (not Did_Hash_Array_Item(&hash, ARR_AT(a, n)))
+            continue;
+
+        REBLEN skip;
+        REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+        for (; indices[slot] != 0; slot = (slot + skip) % num_slots) {
+            if (indices[slot] == n + 1) {  // not there if not first of class
+                indices[slot] = HASHED_ARRAY_TOMBSTONE;
+                break;
+            }
+        }
+    }
+
+    MISC(hashlist).length = index;
+}
+
+
+// Answer an uncased FIND (with no /SKIP or /MATCH) using the hash index, if
+// the target is something it can be used for.  Since only the first item of
+// each class is indexed, this also gives up if an item matching the target
+// comes before the starting index--later items of its class might match.
+//
+static bool Did_Find_In_Hashed_Array(
+    REBLEN *out,
+    REBARR *a,
+    REBLEN index,
+    REBLEN end,
+    const RELVAL *target
+){
+    if (not ANY_WORD(target)) {
+        switch (VAL_TYPE(target)) {
+          case REB_INTEGER:
+          case REB_CHAR:
+          case REB_LOGIC:
+          case REB_BLANK:
+            break;
+
+          default:  // includes quoted targets, and DECIMAL! (see above)
+            return false;
+        }
+    }
+
+    if (index >= end) {
+        *out = NOT_FOUND;
+        return true;
+    }
+
+    uint32_t hash;
+    bool hashable = Did_Hash_Array_Item(&hash, target);
+    assert(hashable);
+    UNUSED(hashable);
+
+    REBSER *hashlist = Update_Array_Hashlist(a);
+    REBLEN *indices = SER_HEAD(REBLEN, hashlist);
+    REBLEN num_slots = SER_LEN(hashlist);
+
+    REBLEN found = NOT_FOUND;
+
+    REBLEN skip;
+    REBLEN slot = First_Hash_Candidate_Slot(&skip, hash, num_slots);
+    for (; indices[slot] != 0; slot = (slot + skip) % num_slots) {
+        if (indices[slot] == HASHED_ARRAY_TOMBSTONE)
+            continue;
+
+        REBLEN n = indices[slot] - 1;
+        const RELVAL *item = ARR_AT(a, n);
+
+        if (ANY_WORD(target)) {  // same test as Find_In_Array()
+            if (not ANY_WORD(item))
+                continue;
+            if (VAL_WORD_CANON(item) != VAL_WORD_CANON(target))
+                continue;
+        }
+        else if (0 != Cmp_Value(item, target, false))
+            continue;
+
+        if (n < index)
+            return false;  // linear search needed
+        if (n < found)
+            found = n;
+    }
+
+    *out = (found >= end) ? NOT_FOUND : found;
+    return true;
+}
+
+
 struct sort_flags {
     bool cased;
     bool reverse;
     REBLEN offset;
     REBVAL *comparator;
+    CMP_VALUE_FUNC *cmp;  // used when no comparator ACTION! is given
     bool all; // !!! not used?
 };
 
@@ -452,13 +762,13 @@ static int Compare_Val(void *arg, const void *v1, const void *v2)
     // !!!! BE SURE that 64 bit large difference comparisons work
 
     if (flags->reverse)
-        return Cmp_Value(
+        return flags->cmp(
             cast(const RELVAL*, v2) + flags->offset,
             cast(const RELVAL*, v1) + flags->offset,
             flags->cased
         );
     else
-        return Cmp_Value(
+        return flags->cmp(
             cast(const RELVAL*, v1) + flags->offset,
             cast(const RELVAL*, v2) + flags->offset,
             flags->cased
@@ -568,6 +878,15 @@ static void Sort_Block(
     else
         skip = 1;
 
+    // Blocks being sorted are usually all one type, so choose a comparator
+    // specialized for the type of the first item.  (Any others still work,
+    // they just take the slower generic path.)
+    //
+    if (flags.offset < skip)
+        flags.cmp = Choose_Comparator(VAL_ARRAY_AT(block) + flags.offset);
+    else
+        flags.cmp = &Cmp_Value;  // !!! offset past the record, review
+
     reb_qsort_r(
         VAL_ARRAY_AT(block),
         len / skip,
@@ -688,8 +1007,10 @@ REB_R PD_Array(
         return nullptr;
     }
 
-    if (opt_setval)
+    if (opt_setval) {
         FAIL_IF_READ_ONLY(pvs->out);
+        Unhash_Array(VAL_ARRAY(pvs->out));
+    }
 
     pvs->u.ref.cell = VAL_ARRAY_AT_HEAD(pvs->out, n);
     pvs->u.ref.specifier = VAL_SPECIFIER(pvs->out);
@@ -908,9 +1229,15 @@ REBTYPE(Array)
         else
             skip = 1;
 
-        REBLEN ret = Find_In_Array(
-            arr, index, limit, pattern, len, flags, skip
-        );
+        REBLEN ret;
+        if (
+            NOT_SERIES_INFO(arr, HASHED)
+            or skip != 1
+            or (flags & (AM_FIND_MATCH | AM_FIND_CASE))
+            or not Did_Find_In_Hashed_Array(&ret, arr, index, limit, pattern)
+        ){
+            ret = Find_In_Array(arr, index, limit, pattern, len, flags, skip);
+        }
 
         if (ret == NOT_FOUND)
             return nullptr;
@@ -988,6 +1315,7 @@ REBTYPE(Array)
         FAIL_IF_READ_ONLY(array);
         REBLEN index = VAL_INDEX(array);
         if (index < VAL_LEN_HEAD(array)) {
+            Unhash_Array_Tail(arr, index);
             if (index == 0) Reset_Array(arr);
             else {
                 SET_END(ARR_AT(arr, index));
@@ -1066,6 +1394,8 @@ REBTYPE(Array)
             temp.extra = a->extra;
             Blit_Cell(VAL_ARRAY_AT(array), VAL_ARRAY_AT(arg));
             Blit_Cell(VAL_ARRAY_AT(arg), &temp);
+            Unhash_Array(arr);
+            Unhash_Array(VAL_ARRAY(arg));
         }
         RETURN (array); }
 
@@ -1079,6 +1409,8 @@ REBTYPE(Array)
         if (len == 0)
             RETURN (array); // !!! do 1-element reversals update newlines?
 
+        Unhash_Array(arr);
+
         RELVAL *front = VAL_ARRAY_AT(array);
         RELVAL *back = front + len - 1;
 
@@ -1127,6 +1459,7 @@ REBTYPE(Array)
         UNUSED(PAR(series));  // covered by `v`
 
         FAIL_IF_READ_ONLY(array);
+        Unhash_Array(arr);
 
         Sort_Block(
             array,
@@ -1168,6 +1501,7 @@ REBTYPE(Array)
         }
 
         FAIL_IF_READ_ONLY(array);
+        Unhash_Array(arr);
         Shuffle_Block(array, did REF(secure));
         RETURN (array); }
 
@@ -1315,6 +1649,53 @@ REBNATIVE(engroup)
 }
 
 
+//
+//  hash-index: native [
+//
+//  {Index the items of an array, so FIND and SELECT on it don't scan them}
+//
+//      return: [any-array!]
+//      array "Loses its file and line information (if any)"
+//          [any-array!]
+//      /off "Drop the index"
+//  ]
+//
+REBNATIVE(hash_index)
+//
+// The index is only used for uncased searches without /SKIP or /MATCH, for
+// a WORD!, INTEGER!, CHAR!, LOGIC! or BLANK!.  It belongs to the array, so
+// every value referring to it benefits.  See SERIES_INFO_HASHED.
+{
+    INCLUDE_PARAMS_OF_HASH_INDEX;
+
+    REBARR *a = VAL_ARRAY(ARG(array));
+
+    if (REF(off)) {
+        if (GET_SERIES_INFO(a, HASHED)) {
+            CLEAR_SERIES_INFO(a, HASHED);
+            CLEAR_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+            LINK(a).custom.node = nullptr;
+        }
+        RETURN (ARG(array));
+    }
+
+    if (NOT_SERIES_INFO(a, HASHED)) {
+        if (
+            GET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK)
+            and NOT_ARRAY_FLAG(a, HAS_FILE_LINE_UNMASKED)
+        ){
+            fail (PAR(array));  // ->link is used for something else
+        }
+        CLEAR_ARRAY_FLAG(a, HAS_FILE_LINE_UNMASKED);
+        SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
+        SET_SERIES_INFO(a, HASHED);
+        Rehash_Array(a);
+    }
+
+    RETURN (ARG(array));
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -117,17 +117,19 @@ REBINT Find_Key_Hashed(
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
+    CMP_VALUE_FUNC *cmp = Choose_Comparator(key);
+
     REBLEN n;
     while ((n = indexes[slot]) != 0) {
         RELVAL *k = ARR_AT(array, (n - 1) * wide); // stored key
-        if (0 == Cmp_Value(k, key, true)) { // exact match
+        if (0 == cmp(k, key, true)) { // exact match
             if (cased)
                 return slot; // don't need to check synonyms, stop looking
             goto found_synonym; // confirm exact match is the only match
         }
 
         if (not cased) {
-            if (0 == Cmp_Value(k, key, false)) { // non-strict match
+            if (0 == cmp(k, key, false)) { // non-strict match
 
               found_synonym:;
 
@@ -76,6 +76,38 @@ static const int window_bits_zlib_raw = -(MAX_WBITS);
 // "raw gzip" would be nonsense, e.g. `-(MAX_WBITS | 16)`
 
 
+//
+//  Window_Bits_For_Envelope: C
+//
+// See notes in Decompress_Alloc_Core() about why gzip is chosen to be
+// invocable via nullptr for bootstrap; not really applicable to compression
+// but might as well be consistent.  (DETECT is for decompression only.)
+//
+static int Window_Bits_For_Envelope(REBSTR *envelope)
+{
+    if (not envelope)
+        return window_bits_gzip;
+
+    switch (STR_SYMBOL(envelope)) {
+      case SYM_NONE:
+        return window_bits_zlib_raw;
+
+      case SYM_ZLIB:
+        return window_bits_zlib;
+
+      case SYM_GZIP:
+        return window_bits_gzip;
+
+      case SYM_DETECT:
+        return window_bits_detect_zlib_gzip;
+
+      default:
+        assert(false); // release build keeps default
+    }
+    return window_bits_gzip;
+}
+
+
 // Inflation and deflation tends to ultimately target series, so we want to
 // be using memory that can be transitioned to a series without reallocation.
 // See rebRepossess() for how rebMalloc()'d pointers can be used this way.
@@ -132,44 +164,26 @@ unsigned char *Compress_Alloc_Core(
     size_t *size_out,
     const void* input,
     size_t size_in,
-    REBSTR *envelope // NONE, ZLIB, or GZIP... null defaults GZIP
+    REBSTR *envelope, // NONE, ZLIB, or GZIP... null defaults GZIP
+    int level  // 0 (store only) to 9 (smallest), or -1 for zlib's default
 ){
     z_stream strm;
     strm.zalloc = &zalloc; // fail() cleans up automatically, see notes
     strm.zfree = &zfree;
     strm.opaque = nullptr; // passed to zalloc and zfree, not needed currently
 
-    int window_bits = window_bits_gzip;
-    if (not envelope) {
-        //
-        // See notes in Decompress_Alloc_Core() about why gzip is chosen to
-        // be invocable via nullptr for bootstrap; not really applicable to
-        // the compression side, but might as well be consistent.
-    }
-    else switch (STR_SYMBOL(envelope)) {
-      case SYM_NONE:
-        window_bits = window_bits_zlib_raw;
-        break;
-
-      case SYM_ZLIB:
-        window_bits = window_bits_zlib;
-        break;
-
-      case SYM_GZIP:
-        window_bits = window_bits_gzip;
-        break;
-
-      default:
-        assert(false); // release build keeps default
-    }
+    assert(not envelope or STR_SYMBOL(envelope) != SYM_DETECT);
+    int window_bits = Window_Bits_For_Envelope(envelope);
 
     // compression level can be a value from 1 to 9, or Z_DEFAULT_COMPRESSION
     // if you want it to pick what the library author considers the "worth it"
-    // tradeoff of time to generally suggest.
+    // tradeoff of time to generally suggest.  Low levels are much faster, and
+    // good for intermediate files that will just be read back in.
     //
+    assert(level >= Z_DEFAULT_COMPRESSION and level <= Z_BEST_COMPRESSION);
     int ret_init = deflateInit2(
         &strm,
-        Z_DEFAULT_COMPRESSION,
+        level,
         Z_DEFLATED,
         window_bits,
         8,
@@ -243,33 +257,11 @@ unsigned char *Decompress_Alloc_Core(
     strm.avail_in = size_in;
     strm.next_in = cast(const z_Bytef*, input);
 
-    int window_bits = window_bits_gzip;
-    if (not envelope) {
-        //
-        // The reason GZIP is chosen as the default is because the symbols
-        // in %words.r are loaded as part of the boot process from code that
-        // is compressed with GZIP, so it's a Catch-22 otherwise.
-    }
-    else switch (STR_SYMBOL(envelope)) {
-      case SYM_NONE:
-        window_bits = window_bits_zlib_raw;
-        break;
-
-      case SYM_ZLIB:
-        window_bits = window_bits_zlib;
-        break;
-
-      case SYM_GZIP:
-        window_bits = window_bits_gzip;
-        break;
-
-      case SYM_DETECT:
-        window_bits = window_bits_detect_zlib_gzip;
-        break;
-
-      default:
-        assert(false); // fall through with default in release build
-    }
+    // The reason GZIP is chosen as the default for a null envelope is because
+    // the symbols in %words.r are loaded as part of the boot process from
+    // code that is compressed with GZIP, so it's a Catch-22 otherwise.
+    //
+    int window_bits = Window_Bits_For_Envelope(envelope);
 
     int ret_init = inflateInit2(&strm, window_bits);
     if (ret_init != Z_OK)
@@ -374,7 +366,7 @@ unsigned char *Decompress_Alloc_Core(
     // e.g. decompression on boot isn't wasting time with this realloc.)
     //
     assert(buf_size >= strm.total_out);
-    if (strm.total_out - buf_size > 1024)
+    if (buf_size - strm.total_out > 1024)
         output = cast(REBYTE*, rebRealloc(output, strm.total_out));
 
     if (size_out)
@@ -385,6 +377,55 @@ unsigned char *Decompress_Alloc_Core(
 }
 
 
+//
+//  Decompress_Into_Core: C
+//
+// For callers who know how big the decompressed data should be, such as PNG
+// (where the image header implies the size of the scanlines).  Inflating
+// right into their buffer avoids the guessing, regrowing, and trimming that
+// Decompress_Alloc_Core() has to do.  Returns how many bytes were written,
+// which is less than `capacity` if the data came up short.  Data that would
+// not fit is an error.
+//
+size_t Decompress_Into_Core(
+    void *output,
+    size_t capacity,
+    const void *input,
+    size_t size_in,
+    REBSTR *envelope // NONE, ZLIB, GZIP, or DETECT... null defaults GZIP
+){
+    z_stream strm;
+    strm.zalloc = &zalloc; // fail() cleans up automatically, see notes
+    strm.zfree = &zfree;
+    strm.opaque = nullptr; // passed to zalloc and zfree, not needed currently
+    strm.total_out = 0;
+
+    strm.avail_in = size_in;
+    strm.next_in = cast(const z_Bytef*, input);
+
+    int ret_init = inflateInit2(&strm, Window_Bits_For_Envelope(envelope));
+    if (ret_init != Z_OK)
+        fail (Error_Compression(&strm, ret_init));
+
+    strm.avail_out = capacity;
+    strm.next_out = cast(REBYTE*, output);
+
+    int ret_inflate = inflate(&strm, Z_FINISH);
+    if (ret_inflate != Z_STREAM_END) {
+        if (ret_inflate == Z_BUF_ERROR and strm.avail_out == 0) {
+            DECLARE_LOCAL (temp);
+            Init_Integer(temp, capacity);
+            fail (Error_Size_Limit_Raw(temp));
+        }
+        fail (Error_Compression(&strm, ret_inflate));
+    }
+
+    size_t size_out = strm.total_out;
+    inflateEnd(&strm);
+    return size_out;
+}
+
+
 //
 //  checksum-core: native [
 //
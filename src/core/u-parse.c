@@ -252,8 +252,10 @@ static bool Subparse_Throws(
     Drop_Action(f);
     Drop_Frame(f);
 
-    if ((r == R_THROWN or IS_NULLED(out)) and opt_collection)
+    if ((r == R_THROWN or IS_NULLED(out)) and opt_collection) {
+        Unhash_Array_Tail(opt_collection, collect_tail);
         TERM_ARRAY_LEN(opt_collection, collect_tail);  // roll back on abort
+    }
 
     if (r == R_THROWN) {
         //
@@ -2655,8 +2657,10 @@ REBNATIVE(subparse)
             if (P_FIND_FLAGS & PF_ONE_RULE)
                 return Init_Nulled(D_OUT);
 
-            if (P_COLLECTION)
+            if (P_COLLECTION) {
+                Unhash_Array_Tail(P_COLLECTION, collection_tail);
                 TERM_ARRAY_LEN(P_COLLECTION, collection_tail);
+            }
 
             FETCH_TO_BAR_OR_END(f);
             if (IS_END(P_RULE)) // no alternate rule
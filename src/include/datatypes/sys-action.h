@@ -343,6 +343,16 @@ inline static void Sync_Paramlist_Archetype(REBARR *paramlist)
 #define IDX_NATIVE_CONTEXT 1 // libRebol binds strings here (and lib)
 #define IDX_NATIVE_MAX (IDX_NATIVE_CONTEXT + 1)
 
+// Interpreted actions (e.g. from FUNC) keep their relativized body in the
+// same slot as a native's body.  If calls to pure actions in that body were
+// precomputed, there are two more slots: a copy of the body with the calls
+// replaced by their results, and a BLOCK! of the words (and what they were
+// looked up to) that the results depended on.  See Fold_Pure_Calls()
+//
+#define IDX_FOLDED_BODY 1
+#define IDX_FOLD_GUARDS 2
+#define IDX_FOLDED_MAX (IDX_FOLD_GUARDS + 1)
+
 inline static REBVAL *ACT_PARAM(REBACT *a, REBLEN n) {
     assert(n != 0 and n < ARR_LEN(ACT_PARAMLIST(a)));
     return SER_AT(REBVAL, SER(ACT_PARAMLIST(a)), n);
@@ -227,8 +227,8 @@ inline static REBARR *Make_Array_Core(REBLEN capacity, REBFLGS flags) {
     ){
         capacity += 1; // account for cell needed for terminator (END)
 
-        if (cast(REBU64, capacity) * wide > INT32_MAX) // too big
-            fail (Error_No_Memory(cast(REBU64, capacity) * wide));
+        if (Is_Over_Series_Budget(nullptr, cast(REBU64, capacity) * wide))
+            fail (Error_Series_Too_Big(cast(REBU64, capacity) * wide));
 
         s->info = Endlike_Header(FLAG_LEN_BYTE_OR_255(255)); // dynamic
         if (not Did_Series_Data_Alloc(s, capacity)) // expects LEN_BYTE=255
@@ -348,6 +348,30 @@ inline static REBARR *Alloc_Singular(REBFLGS flags) {
     return a;
 }
 
+//=//// ARRAY_FLAG_COMPOSE_SCANNED ////////////////////////////////////////=//
+//
+// COMPOSE/DEEP shares sub-arrays that have no GROUP! anywhere beneath them,
+// rather than walking and copying them.  Since a frozen array (see LOCK) can
+// never change, the answer for one is cached on it in these plain-array
+// flags the first time it is asked.  See Array_Has_Groups_Deep()
+//
+#define ARRAY_FLAG_COMPOSE_SCANNED \
+    ARRAY_FLAG_30
+
+#define ARRAY_FLAG_COMPOSE_HAS_GROUPS \
+    ARRAY_FLAG_31
+
+
+// Changing items of a hashed array anywhere but at its tail means the hash
+// index has to be rebuilt.  Only the count of indexed items is zeroed here,
+// the next FIND or SELECT notices that and does the work if it's needed.
+// (See SERIES_INFO_HASHED and %t-block.c)
+//
+inline static void Unhash_Array(REBARR *a) {
+    if (GET_SERIES_INFO(a, HASHED))
+        MISC(SER(LINK(a).custom.node)).length = 0;
+}
+
 #define Append_Value(a,v) \
     Move_Value(Alloc_Tail_Array(a), (v))
 
@@ -200,16 +200,69 @@ inline static const char* Frame_Label_Or_Anonymous_UTF8(REBFRM *f) {
 // This privileged level of access can be used by natives that feel they can
 // optimize performance by working with the evaluator directly.
 
-inline static void Reuse_Varlist_If_Available(REBFRM *f) {
-    assert(IS_POINTER_TRASH_DEBUG(f->varlist));
-    if (not TG_Reuse)
-        f->varlist = nullptr;
-    else {
-        f->varlist = TG_Reuse;
-        TG_Reuse = LINK(TG_Reuse).reuse;
-        f->rootvar = cast(REBVAL*, SER(f->varlist)->content.dynamic.data);
-        LINK_KEYSOURCE(f->varlist) = NOD(f);
+// Size class of varlist to use for an action needing `capacity` cells, or
+// NUM_VARLIST_REUSE_CLASSES if it's too big for any of them.
+//
+inline static REBLEN Varlist_Reuse_Class(REBLEN capacity) {
+    REBLEN size_class = 0;
+    for (; size_class < NUM_VARLIST_REUSE_CLASSES; ++size_class) {
+        if (capacity <= (MIN_VARLIST_CAPACITY << size_class))
+            return size_class;
+    }
+    return NUM_VARLIST_REUSE_CLASSES;
+}
+
+inline static REBARR *Try_Reuse_Varlist(REBFRM *f, REBLEN size_class) {
+    if (size_class == NUM_VARLIST_REUSE_CLASSES or not TG_Reuse[size_class]) {
+      #if !defined(NDEBUG)
+        PG_Reb_Stats->Varlist_Reuse_Misses++;
+      #endif
+        return nullptr;
+    }
+
+  #if !defined(NDEBUG)
+    PG_Reb_Stats->Varlist_Reuse_Hits++;
+  #endif
+
+    REBARR *varlist = TG_Reuse[size_class];
+    TG_Reuse[size_class] = LINK(varlist).reuse;
+    --TG_Reuse_Depth[size_class];
+
+    f->rootvar = cast(REBVAL*, SER(varlist)->content.dynamic.data);
+    LINK_KEYSOURCE(varlist) = NOD(f);
+    return varlist;
+}
+
+// A dropped varlist goes in the list of the biggest class it can serve.  If
+// it's smaller than any class (e.g. the exact-size varlist of a FRAME! that
+// was DO'd) or that list is full, it is freed.  So is one more than twice
+// the biggest class (the exact-size varlist of an action with many args),
+// rather than pin all that memory for calls that need a fraction of it.
+// (Twice, since the memory pools may round a class's allocation up.)
+//
+inline static void Release_Varlist_For_Reuse(REBARR *varlist) {
+    assert(NOT_SERIES_FLAG(varlist, MANAGED));
+
+    REBLEN rest = SER(varlist)->content.dynamic.rest;
+    REBLEN size_class = NUM_VARLIST_REUSE_CLASSES;
+    if (rest > (MIN_VARLIST_CAPACITY << NUM_VARLIST_REUSE_CLASSES))
+        size_class = 0;  // skip the loop
+
+    while (size_class != 0) {
+        --size_class;
+        if (rest < (MIN_VARLIST_CAPACITY << size_class))
+            continue;
+
+        if (TG_Reuse_Depth[size_class] == MAX_VARLIST_REUSE_DEPTH)
+            break;
+
+        LINK(varlist).reuse = TG_Reuse[size_class];
+        TG_Reuse[size_class] = varlist;
+        ++TG_Reuse_Depth[size_class];
+        return;
     }
+
+    GC_Kill_Series(SER(varlist));  // no track for Free_Unmanaged_Series()
 }
 
 inline static void Push_Frame_No_Varlist(REBVAL *out, REBFRM *f)
@@ -341,8 +394,8 @@ inline static void Push_Frame_No_Varlist(REBVAL *out, REBFRM *f)
   #endif
 
     // Eval_Core() expects a varlist to be in the frame, therefore it must
-    // be filled in by Reuse_Varlist(), or if this is something like a DO
-    // of a FRAME! it needs to be filled in from that frame before eval'ing.
+    // be filled in by Push_Frame(), or if this is something like a DO of a
+    // FRAME! it needs to be filled in from that frame before eval'ing.
     //
     TRASH_POINTER_IF_DEBUG(f->varlist);
 }
@@ -350,7 +403,11 @@ inline static void Push_Frame_No_Varlist(REBVAL *out, REBFRM *f)
 inline static void Push_Frame(REBVAL *out, REBFRM *f)
 {
     Push_Frame_No_Varlist(out, f);
-    Reuse_Varlist_If_Available(f);
+
+    // Which varlist to reuse depends on how many arguments the action has,
+    // so that is deferred until Push_Action()
+    //
+    f->varlist = nullptr;
 }
 
 inline static void UPDATE_EXPRESSION_START(REBFRM *f) {
@@ -425,11 +482,8 @@ inline static void Drop_Frame_Core(REBFRM *f) {
     free(f->stress);
   #endif
 
-    if (f->varlist) {
-        assert(NOT_SERIES_FLAG(f->varlist, MANAGED));
-        LINK(f->varlist).reuse = TG_Reuse;
-        TG_Reuse = f->varlist;
-    }
+    if (f->varlist)
+        Release_Varlist_For_Reuse(f->varlist);
     TRASH_POINTER_IF_DEBUG(f->varlist);
 
     assert(TG_Top_Frame == f);
@@ -469,6 +523,7 @@ inline static void Prep_Frame_Core(
     f->dsp_orig = DS_Index;
     f->flags = Endlike_Header(flags);
     TRASH_POINTER_IF_DEBUG(f->out);
+    f->num_api_handles = 0;
 
   #ifdef DEBUG_ENSURE_FRAME_EVALUATES
     f->was_eval_called = false;
@@ -569,37 +624,44 @@ inline static void Push_Action(
     f->param = ACT_PARAMS_HEAD(act); // Specializations hide some params...
     REBLEN num_args = ACT_NUM_PARAMS(act); // ...so see REB_TS_HIDDEN
 
-    // !!! Note: Should pick "smart" size when allocating varlist storage due
-    // to potential reuse--but use exact size for *this* action, for now.
+    // Varlist storage is reused by the next action run in this frame (and by
+    // other frames, see TG_Reuse).  So don't allocate the exact size for
+    // *this* action, but the capacity of its size class.
     //
+    REBLEN capacity = num_args + 1 + 1;  // +rootvar, +end
+    REBLEN size_class = Varlist_Reuse_Class(capacity);
+    if (size_class != NUM_VARLIST_REUSE_CLASSES)
+        capacity = MIN_VARLIST_CAPACITY << size_class;
+
     REBSER *s;
-    if (not f->varlist) { // usually means first action call in the REBFRM
-        s = Alloc_Series_Node(
-            SERIES_MASK_VARLIST
-                | SERIES_FLAG_STACK_LIFETIME
-                | SERIES_FLAG_FIXED_SIZE // FRAME!s don't expand ATM
-        );
-        s->info = Endlike_Header(
-            FLAG_WIDE_BYTE_OR_0(0) // signals array, also implicit terminator
-                | FLAG_LEN_BYTE_OR_255(255) // signals dynamic
-        );
-        INIT_LINK_KEYSOURCE(s, NOD(f)); // maps varlist back to f
-        MISC_META_NODE(s) = nullptr; // GC will sees this
-        f->varlist = ARR(s);
-    }
-    else {
+    if (f->varlist) {  // e.g. an earlier action call in this REBFRM
         s = SER(f->varlist);
-        if (s->content.dynamic.rest >= num_args + 1 + 1) // +roovar, +end
+        if (s->content.dynamic.rest >= num_args + 1 + 1) // +rootvar, +end
             goto sufficient_allocation;
 
-        //assert(SER_BIAS(s) == 0);
-        Free_Unbiased_Series_Data(
-            s->content.dynamic.data,
-            SER_TOTAL(s)
-        );
+        Release_Varlist_For_Reuse(f->varlist);  // may suit some other call
     }
 
-    if (not Did_Series_Data_Alloc(s, num_args + 1 + 1)) // +rootvar, +end
+    f->varlist = Try_Reuse_Varlist(f, size_class);
+    if (f->varlist) {
+        s = SER(f->varlist);
+        goto sufficient_allocation;
+    }
+
+    s = Alloc_Series_Node(
+        SERIES_MASK_VARLIST
+            | SERIES_FLAG_STACK_LIFETIME
+            | SERIES_FLAG_FIXED_SIZE // FRAME!s don't expand ATM
+    );
+    s->info = Endlike_Header(
+        FLAG_WIDE_BYTE_OR_0(0) // signals array, also implicit terminator
+            | FLAG_LEN_BYTE_OR_255(255) // signals dynamic
+    );
+    INIT_LINK_KEYSOURCE(s, NOD(f)); // maps varlist back to f
+    MISC_META_NODE(s) = nullptr; // GC will sees this
+    f->varlist = ARR(s);
+
+    if (not Did_Series_Data_Alloc(s, capacity))
         fail ("Out of memory in Push_Action()");
 
     f->rootvar = cast(REBVAL*, s->content.dynamic.data);
@@ -682,6 +744,18 @@ inline static void Drop_Action(REBFRM *f) {
         or LINK_KEYSOURCE(f->varlist) == NOD(f)
     );
 
+    // API handles that are still outstanding will outlive the call, so
+    // their owner has to become a real (managed) FRAME! context now.  If a
+    // fail() is unwinding that lets the GC free them, and otherwise it lets
+    // the GC catch the leak.  This goes for an INACCESSIBLE stub too, which
+    // mustn't be freed below while the handles still name it as the owner.
+    // See notes on REBFRM.num_api_handles
+    //
+    if (f->num_api_handles != 0) {
+        SET_SERIES_FLAG(f->varlist, MANAGED);
+        f->num_api_handles = 0;
+    }
+
     if (GET_SERIES_INFO(f->varlist, INACCESSIBLE)) {
         //
         // If something like Encloser_Dispatcher() runs, it might steal the
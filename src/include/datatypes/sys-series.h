@@ -692,7 +692,9 @@ inline static REBSER *Alloc_Series_Node(REBFLGS flags) {
 
     REBSER *s = cast(REBSER*, Make_Node(SER_POOL));
     if ((GC_Ballast -= sizeof(REBSER)) <= 0)
-        SET_SIGNAL(SIG_RECYCLE);
+        SET_SIGNAL_AND_POLL(SIG_RECYCLE);
+    if ((TG_Budget_Bytes_Left -= sizeof(REBSER)) < 0)
+        Poll_Signals_Soon();  // over a BUDGET/MEMORY, fail at a safe point
 
     // Out of the 8 platform pointers that comprise a series node, only 3
     // actually need to be initialized to get a functional non-dynamic series
@@ -820,13 +822,45 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN length) {
     // See if allocation tripped our need to queue a garbage collection
 
     if ((GC_Ballast -= size) <= 0)
-        SET_SIGNAL(SIG_RECYCLE);
+        SET_SIGNAL_AND_POLL(SIG_RECYCLE);
+    if ((TG_Budget_Bytes_Left -= size) < 0)
+        Poll_Signals_Soon();  // over a BUDGET/MEMORY, fail at a safe point
 
     assert(SER_TOTAL(s) == size);
     return true;
 }
 
 
+// BUDGET/SERIES limits what the code being run makes.  The interpreter's own
+// buffers (the GC's stacks, the data stack, the mold buffer...) grow on
+// behalf of whatever is running, and failing while one is being extended
+// (e.g. in the middle of a recycle) would leave it in a bad state.  So they
+// are only held to the 2GB that all series are, as is anything made while
+// the GC runs.  Pass nullptr for `s` when a new series is being made.
+//
+inline static bool Is_Over_Series_Budget(REBSER *s, REBU64 bytes) {
+    if (bytes <= TG_Budget_Series_Max)
+        return false;
+    if (bytes > INT32_MAX)
+        return true;
+    if (GC_Recycling)
+        return false;
+    if (s == nullptr)
+        return true;
+    return not (
+        s == GC_Mark_Stack
+        or s == GC_Guarded
+        or s == GC_Manuals
+        or s == SER(DS_Array)
+        or s == SER(TG_Mold_Buf)
+        or s == TG_Mold_Stack
+        or s == TG_Byte_Buf
+        or s == SER(TG_Buf_Collect)
+        or s == PG_Canons_By_Hash
+    );
+}
+
+
 // If the data is tiny enough, it will be fit into the series node itself.
 // Small series will be allocated from a memory pool.
 // Large series will be allocated from system memory.
@@ -838,8 +872,8 @@ inline static REBSER *Make_Series_Core(
 ){
     assert(not (flags & ARRAY_FLAG_HAS_FILE_LINE_UNMASKED));
 
-    if (cast(REBU64, capacity) * wide > INT32_MAX)
-        fail (Error_No_Memory(cast(REBU64, capacity) * wide));
+    if (Is_Over_Series_Budget(nullptr, cast(REBU64, capacity) * wide))
+        fail (Error_Series_Too_Big(cast(REBU64, capacity) * wide));
 
     // Non-array series nodes do not need their info bits to conform to the
     // rules of Endlike_Header(), so plain assignment can be used with a
@@ -230,6 +230,18 @@ typedef REBVAL *REB_R;
 typedef REBINT (COMPARE_HOOK)(const REBCEL *a, const REBCEL *b, REBINT s);
 
 
+// VALUE COMPARATORS, with the interface of Cmp_Value() (difference-style
+// result, CASE flag).  Choose_Comparator() picks one specialized to the
+// type of a value that an operation will compare against repeatedly, so a
+// SORT or a FIND doesn't have to dispatch on type for every comparison.
+//
+typedef REBINT (CMP_VALUE_FUNC)(
+    const RELVAL *s,
+    const RELVAL *t,
+    bool is_case
+);
+
+
 // PER-TYPE MAKE HOOKS: for `make datatype def`
 //
 // These functions must return a REBVAL* to the type they are making
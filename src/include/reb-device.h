@@ -112,7 +112,9 @@ enum {
     RFM_TRUNCATE = 1 << 6,
     RFM_RESEEK = 1 << 7, // file index has moved, reseek
     RFM_DIR = 1 << 8,
-    RFM_TEXT = 1 << 9 // on appropriate platforms, translate LF to CR LF
+    RFM_TEXT = 1 << 9, // on appropriate platforms, translate LF to CR LF
+    RFM_ASYNC = 1 << 10, // READ completes later, with an event (if supported)
+    RFM_PIECES = 1 << 11 // WRITE a BLOCK! of BINARY!/TEXT! in common.binary
 };
 
 #define MAX_FILE_NAME 1022
@@ -217,6 +217,12 @@ typedef struct rebol_stats {
     REBLEN  Mark_Count;
     REBLEN  Blocks;
     REBLEN  Objects;
+    REBLEN  Varlist_Reuse_Hits;
+    REBLEN  Varlist_Reuse_Misses;
+    REBLEN  Compose_Cells_Copied;
+    REBLEN  Compose_Cells_Shared;
+    REBLEN  Shape_Cache_Hits;
+    REBLEN  Shape_Cache_Misses;
 } REB_STATS;
 
 //-- Options of various kinds:
@@ -391,16 +397,99 @@ enum rebol_signals {
     SIG_EVENT_PORT = 1 << 3
 };
 
-inline static void SET_SIGNAL(REBFLGS f) { // used in %sys-series.h
-    Eval_Signals |= f;
-    Eval_Count = 1;
-}
+// The pending signal word, Eval_Signals, is the one piece of evaluator state
+// that may be written from outside the evaluator's flow of control: a POSIX
+// signal handler (e.g. SIGINT in the console), the Windows console control
+// thread, an I/O callback.  So SET_SIGNAL() does nothing but an atomic OR of
+// a bit into that word, which makes it async-signal-safe.  It deliberately
+// does not touch the Eval_Count countdown: the evaluator notices the bit the
+// next time the countdown runs out, which bounds the latency of delivery to
+// EVAL_DOSE steps without adding a second test to every evaluator step.
+//
+// Code running on the evaluator's own thread that wants a signal looked at
+// right away (e.g. memory allocation asking for a GC) uses the non-atomic
+// SET_SIGNAL_AND_POLL() to also cut the countdown short.  That first banks
+// the steps already taken into Eval_Cycles, so that STATS/EVALS and the
+// Eval_Limit quota remain exact.
+//
+// Compiler intrinsics are used instead of <stdatomic.h>, since the core is
+// still built as C89 and C++98.  Compilers that have neither (e.g. TCC when
+// compiling user natives) get a plain volatile read-modify-write, which is
+// what R3-Alpha did everywhere.
+//
+#define EVAL_DOSE 10000
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+
+    STATIC_ASSERT(sizeof(REBFLGS) == sizeof(long));
+
+    #define Fetch_Or_Signals(f) \
+        cast(REBFLGS, _InterlockedOr( \
+            cast(volatile long*, &Eval_Signals), cast(long, (f))))
+
+    #define Fetch_And_Signals(f) \
+        cast(REBFLGS, _InterlockedAnd( \
+            cast(volatile long*, &Eval_Signals), cast(long, (f))))
+
+    #define Load_Signals() \
+        Fetch_Or_Signals(0)
+
+#elif defined(__clang__) || ( \
+    defined(__GNUC__) && !defined(__TINYC__) \
+    && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)) \
+)
+    #define Fetch_Or_Signals(f) \
+        __atomic_fetch_or(&Eval_Signals, (f), __ATOMIC_SEQ_CST)
+
+    #define Fetch_And_Signals(f) \
+        __atomic_fetch_and(&Eval_Signals, (f), __ATOMIC_SEQ_CST)
+
+    #define Load_Signals() \
+        __atomic_load_n(&Eval_Signals, __ATOMIC_SEQ_CST)
+
+#else
+    inline static REBFLGS Fetch_Or_Signals(REBFLGS f) {
+        REBFLGS old = Eval_Signals;
+        Eval_Signals = old | f;
+        return old;
+    }
+
+    inline static REBFLGS Fetch_And_Signals(REBFLGS f) {
+        REBFLGS old = Eval_Signals;
+        Eval_Signals = old & f;
+        return old;
+    }
+
+    #define Load_Signals() \
+        cast(REBFLGS, Eval_Signals)
+#endif
+
+inline static void SET_SIGNAL(REBFLGS f)  // async-signal-safe
+  { Fetch_Or_Signals(f); }
 
 #define GET_SIGNAL(f) \
-    (did (Eval_Signals & (f)))
+    (did (Load_Signals() & (f)))
 
 #define CLR_SIGNAL(f) \
-    cast(void, Eval_Signals &= ~(f))
+    cast(void, Fetch_And_Signals(~cast(REBFLGS, (f))))
+
+// Test and clear as one operation, so that a signal raised by a handler in
+// between a GET_SIGNAL() and a CLR_SIGNAL() can't be lost.
+//
+inline static bool TAKE_SIGNAL(REBFLGS f)
+  { return did (Fetch_And_Signals(~f) & f); }
+
+inline static void Poll_Signals_Soon(void) {  // evaluator thread only
+    Eval_Cycles += Eval_Dose - Eval_Count;
+    Eval_Dose = 1;
+    Eval_Count = 1;
+}
+
+inline static void SET_SIGNAL_AND_POLL(REBFLGS f) {  // evaluator thread only
+    SET_SIGNAL(f);
+    Poll_Signals_Soon();
+}
 
 #include "datatypes/sys-series.h"
 #include "datatypes/sys-array.h"  // REBARR used by UTF-8 string bookmarks
@@ -138,9 +138,10 @@ PVAR REBVAL *Root_Stackoverflow_Error; // made in advance, avoids extra calls
 
 PVAR REBARR *PG_Extension_Types;  // array of datatypes created by extensions
 
-// This signal word should be thread-local, but it will not work
-// when implemented that way. Needs research!!!!
-PVAR REBFLGS Eval_Signals;   // Signal flags
+// Pending signal flags.  This is process-wide and may be set from signal
+// handlers or other threads, so only touch it via SET_SIGNAL() and friends.
+//
+PVAR volatile REBFLGS Eval_Signals;
 
 // The "dummy" action is used in frames which are marked as being action
 // frames because they need a varlist, that don't actually execute.
@@ -196,6 +197,7 @@ TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 TVAR REBARR *TG_Buf_Collect; // for collecting object keys or words
 TVAR REBSER *TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR REBSTR *TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
+TVAR REBLEN TG_Mold_Depth; // Push_Mold()s not yet popped or dropped
 
 TVAR REBSER *GC_Manuals;    // Manually memory managed (not by GC)
 
@@ -221,11 +223,21 @@ TVAR struct Reb_Feed TG_Frame_Feed_End;
 
 
 // When Drop_Frame() happens, it may have an allocated varlist REBARR that
-// can be reused by the next Push_Frame().  Reusing this has a significant
+// can be reused by the next Push_Action().  Reusing this has a significant
 // performance impact, as opposed to paying for freeing the memory when a
 // frame is dropped and then reallocating it when the next one is pushed.
 //
-TVAR REBARR *TG_Reuse;
+// The varlists are kept in separate lists by capacity, so that an action
+// with many parameters doesn't have to throw away the small varlist it gets
+// and allocate a new one (and vice versa).  See Try_Reuse_Varlist().
+//
+TVAR REBARR *TG_Reuse[NUM_VARLIST_REUSE_CLASSES];
+TVAR REBLEN TG_Reuse_Depth[NUM_VARLIST_REUSE_CLASSES];
+
+// Keylists recently made by MAKE OBJECT! from spec blocks, so that making
+// many objects from the same spec can share one.  See Find_Shape().
+//
+TVAR struct Reb_Shape TG_Shapes[NUM_SHAPE_CACHE_SLOTS];
 
 //-- Evaluation stack:
 TVAR REBARR *DS_Array;
@@ -245,8 +257,17 @@ TVAR int_fast32_t Eval_Count;     // Evaluation counter (downward)
 TVAR uint_fast32_t Eval_Dose;      // Evaluation counter reset value
 TVAR REBFLGS Eval_Sigmask;   // Masking out signal flags
 
+//-- Limits set by the innermost BUDGET (see %c-budget.c):
+TVAR REBI64 TG_Budget_Steps_End;  // fail when Eval_Cycles goes past this
+TVAR REBI64 TG_Budget_Clock_End;  // fail when clock() reaches this (if not 0)
+TVAR REBI64 TG_Budget_Bytes_Left;  // series memory that may still be made
+TVAR REBU64 TG_Budget_Series_Max;  // largest series allocation, in bytes
+
 TVAR REBFLGS Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
 TVAR REBINT Trace_Depth;    // Tracks trace indentation
-TVAR REBLEN Trace_Limit;    // Backtrace buffering limit
-TVAR REBSER *Trace_Buffer;  // Holds backtrace lines
+TVAR struct Reb_Trace_Event *Trace_Ring;  // TRACE/RECORD events, or nullptr
+TVAR REBLEN Trace_Ring_Size;  // capacity of Trace_Ring (a power of 2)
+TVAR uint64_t Trace_Ring_Count;  // events recorded since last cleared
+TVAR uint64_t Trace_Usec;  // last clock() sample, see TRACE_CLOCK_INTERVAL
+TVAR REBNAT Trace_Saved_Dispatch;  // hook that TRACE/RECORD was put in over
@@ -23,6 +23,11 @@
 
 #define MOLD_BUF TG_Mold_Buf
 
+// Smallest popped mold which may take over the mold buffer's allocation
+// instead of being copied out of it (see Pop_Molded_String())
+//
+#define MOLD_HANDOVER_MIN_SIZE (MIN_COMMON * 4)
+
 struct rebol_mold {
     REBSTR *series;     // destination series (utf8)
     REBLEN index;       // codepoint index where mold starts within series
@@ -84,3 +84,21 @@ struct Reb_Context {
     }
 
 #endif
+
+
+// Keylists ("shapes") of objects recently made by MAKE OBJECT! from a spec
+// block are kept in a small cache (TG_Shapes), indexed by a hash of where
+// the spec's set-words were collected from.  A hit must still match the
+// spelling of every top-level SET-WORD! in order, so edits to the spec are
+// noticed.  Only shapes with up to MAX_SHAPE_SET_WORDS set-words are cached.
+// The cache doesn't keep keylists alive, so the GC clears it.
+//
+#define NUM_SHAPE_CACHE_SLOTS 64
+#define MAX_SHAPE_SET_WORDS 16
+
+struct Reb_Shape {
+    const RELVAL *head;  // position set-words were collected from
+    REBARR *keylist;  // nullptr if the slot is unused
+    REBLEN num_set_words;  // including duplicates
+    REBSTR *spellings[MAX_SHAPE_SET_WORDS];
+};
@@ -394,6 +394,19 @@ STATIC_ASSERT(31 < 32); // otherwise EVAL_FLAG_XXX too high
 
 #define TRASHED_INDEX ((REBLEN)(-3))
 
+
+// Varlists of dropped frames are kept for reuse in lists by size class, see
+// TG_Reuse.  The smallest class holds MIN_VARLIST_CAPACITY cells (including
+// the rootvar and end), and each class after that doubles it.  Actions with
+// more arguments than the biggest class can hold allocate exact-size
+// varlists.  Those are reused by the biggest class if they are at most twice
+// its size, else freed when dropped.  Each list is capped at a depth, so
+// a one-off deep recursion doesn't pin memory until the next GC.
+//
+#define MIN_VARLIST_CAPACITY 8
+#define NUM_VARLIST_REUSE_CLASSES 4  // 8, 16, 32, 64 cells
+#define MAX_VARLIST_REUSE_DEPTH 128
+
 #define IS_KIND_INERT(k) \
     ((k) >= REB_BLOCK)
 
@@ -641,6 +654,15 @@ struct Reb_Frame {
     REBARR *varlist;
     REBVAL *rootvar; // cache of CTX_ARCHETYPE(varlist) if varlist is not null
 
+    // API handles allocated while an action runs are owned by its varlist,
+    // so they can be freed if the frame fails.  But ownership alone does not
+    // make the varlist managed (which would keep a native that uses the API
+    // from reusing its varlist on the next call).  The frame just counts the
+    // outstanding handles, and only if some are left when the action is
+    // dropped does the varlist get managed.  See Alloc_Value(), Drop_Action()
+    //
+    REBLEN num_api_handles;
+
     // We use the convention that "param" refers to the TYPESET! (plus symbol)
     // from the spec of the function--a.k.a. the "formal argument".  This
     // pointer is moved in step with `arg` during argument fulfillment.
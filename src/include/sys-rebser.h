@@ -468,9 +468,17 @@ STATIC_ASSERT(SERIES_INFO_7_IS_FALSE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(28)
 
 
-//=//// SERIES_INFO_29 ////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_HASHED ////////////////////////////////////////////////=//
 //
-#define SERIES_INFO_29 \
+// An array may have a hash index of its items attached, so FIND and SELECT
+// don't have to scan it (see HASH-INDEX).  The hashlist lives in the ->link
+// field, so a hashed array can't also carry file and line information.
+//
+// Items appended to the array are indexed lazily by the next search, and
+// removals from the tail are taken out of the index as they happen.  Other
+// changes just "unhash" the array, which makes the next search rebuild it.
+//
+#define SERIES_INFO_HASHED \
     FLAG_LEFT_BIT(29)
 
 
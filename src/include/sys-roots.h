@@ -102,6 +102,28 @@ inline static REBCTX *Context_For_Frame_May_Manage(REBFRM *f) {
 }
 
 
+// API handles are owned by the varlist of the action frame they are made in,
+// but this does not manage the varlist.  It stays unmanaged (and reusable
+// by the next action call) unless handles are still around when the action
+// is dropped.  See notes on REBFRM.num_api_handles
+//
+inline static REBARR *Varlist_For_Api_Owner(REBFRM *f) {
+    assert(not Is_Action_Frame_Fulfilling(f));
+    ++f->num_api_handles;
+    return f->varlist;
+}
+
+inline static void Disown_Api_Handle(REBARR *owner) {
+    REBNOD *keysource = LINK_KEYSOURCE(owner);
+    if (not (keysource->header.bits & NODE_FLAG_CELL))
+        return;  // frame no longer running, nothing to account for
+
+    REBFRM *f = FRM(keysource);
+    assert(f->num_api_handles != 0);
+    --f->num_api_handles;
+}
+
+
 // What distinguishes an API value is that it has both the NODE_FLAG_CELL and
 // NODE_FLAG_ROOT bits set.
 //
@@ -131,7 +153,7 @@ inline static REBVAL *Alloc_Value(void)
     while (not Is_Action_Frame(f)) // e.g. a path fulfillment
         f = f->prior; // FS_BOTTOM is a dummy action, should always stop
 
-    LINK(a).owner = NOD(Context_For_Frame_May_Manage(f));
+    LINK(a).owner = NOD(Varlist_For_Api_Owner(f));
     return v;
 }
 
@@ -140,6 +162,9 @@ inline static void Free_Value(REBVAL *v)
     assert(Is_Api_Value(v));
 
     REBARR *a = Singular_From_Cell(v);
+    if (GET_SERIES_FLAG(a, MANAGED) and LINK(a).owner)
+        Disown_Api_Handle(ARR(LINK(a).owner));
+
     TRASH_CELL_IF_DEBUG(ARR_SINGLE(a));
     GC_Kill_Series(SER(a));
 }
@@ -84,14 +84,16 @@ decode: function [
     data [binary!]
         {The data to decode}
 ][
+    ; Don't test the decoded result for truthiness, as codecs like JSON can
+    ; legitimately decode data to FALSE or BLANK!.
+    ;
     all [
         cod: select system/codecs type
         f: :cod/decode
-        (data: f data)
     ] else [
         cause-error 'access 'no-codec type
     ]
-    data
+    f data
 ]
 
 
@@ -98,6 +98,7 @@
 %control/any.test.reb
 %control/attempt.test.reb
 %control/break.test.reb
+%control/budget.test.reb
 %control/case.test.reb
 %control/catch.test.reb
 %control/compose.test.reb
@@ -144,9 +145,13 @@
 %convert/to-hex.test.reb
 
 %file/clean-path.test.reb
+%file/copy-file.test.reb
 %file/existsq.test.reb
 %file/make-dir.test.reb
 %file/open.test.reb
+%file/read-files.test.reb
+%file/walk-dir.test.reb
+%file/write-pieces.test.reb
 %file/split-path.test.reb
 %file/file-typeq.test.reb
 
@@ -202,6 +207,7 @@
 %math/zeroq.test.reb
 %misc/assert.test.reb
 %misc/help.test.reb
+%misc/trace.test.reb
 
 %network/http.test.reb
 
@@ -221,6 +227,7 @@
 %series/charset.test.reb
 %series/clear.test.reb
 %series/copy.test.reb
+%series/dedupe.test.reb
 %series/delimit.test.reb
 %series/difference.test.reb
 %series/emptyq.test.reb
@@ -269,7 +276,11 @@
 
 %../extensions/vector/tests/vector.test.reb
 %../extensions/process/tests/call.test.reb
+%../extensions/process/tests/parallel.test.reb
 %../extensions/dns/tests/dns.test.reb
+%../extensions/csv/tests/csv.test.reb
+%../extensions/rebin/tests/rebin.test.reb
+%../extensions/secure/tests/secure.test.reb
 
 
 ; SOURCE ANALYSIS: Check to make sure the Rebol files are "lint"-free, and
@@ -22,17 +22,24 @@ start-response: func [port res <local> code text type body] [
     write port unspaced [
         "HTTP/1.0" _ code _ code-map/:code CR LF
         "Content-type:" _ type CR LF
-        "Content-length:" _ (length of body) CR LF
-        CR LF
+        "Content-length:" _ (either file? body [size? body] [length of body])
+        CR LF CR LF
     ]
     ; Manual chunking is only necessary because of several bugs in R3's
     ; networking stack (mainly cc#2098 & cc#2160; in some constellations also
     ; cc#2103). Once those are fixed, we should directly use R3's internal
     ; chunking instead: `write port body`.
-    port/locals: copy body
+    port/locals: either file? body [body] [copy body]
 ]
 
-send-chunk: func [port] [
+send-chunk: func [port <local> file] [
+    ; A FILE! is sent straight from the file by the network code, without
+    ; reading it into memory.
+    if file? file: port/locals [
+        port/locals: copy #{}
+        return write port file
+    ]
+
     ; Trying to send data >32'000 bytes at once will trigger R3's internal
     ; chunking (which is buggy, see above). So we cannot use chunks >32'000
     ; for our manual chunking.
@@ -50,8 +57,8 @@ handle-request: function [config req] [
     parse uri [some [thru "."] copy ext to end (type: mime-map/:ext)]
     type: default ["application/octet-stream"]
     if not exists? file: config/root/:uri [return error-response 404 uri]
-    if error? trap [data: read file] [return error-response 400 uri]
-    reduce [200 type data]
+    if error? trap [close open/read file] [return error-response 400 uri]
+    reduce [200 type file]
 ]
 
 awake-client: function [event] [
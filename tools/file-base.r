@@ -26,6 +26,7 @@ core: [
 
     ; (C)ore
     c-bind.c
+    c-budget.c
     c-do.c
     c-context.c
     c-error.c